@@ -0,0 +1,66 @@
+#include <benchmark/benchmark.h>
+
+#include <future>
+
+#include "CPPAsyncResult.hpp"
+
+using SEFUtility::AsyncResult;
+using SEFUtility::AsyncResultPromise;
+using SEFUtility::ResultWithReturnValue;
+
+enum class TaskErrorCodes
+{
+    SUCCESS = 0,
+    TASK_FAILED = 1000
+};
+
+typedef ResultWithReturnValue<TaskErrorCodes, int> TaskResult;
+
+//
+//  Cost of a single result hand off, with std::promise/std::future as the baseline.  Both sides run on the
+//      benchmark thread so only the channel itself is measured.
+//
+
+static void BM_HandOffStdFuture(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        std::promise<TaskResult> promise;
+        std::future<TaskResult> future = promise.get_future();
+
+        promise.set_value(TaskResult::success(1));
+
+        benchmark::DoNotOptimize(future.get().return_value());
+    }
+}
+BENCHMARK(BM_HandOffStdFuture);
+
+static void BM_HandOffAsyncResult(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        AsyncResultPromise<TaskErrorCodes, int> promise;
+        AsyncResult<TaskErrorCodes, int> async_result = promise.get_async_result();
+
+        promise.set_result(TaskResult::success(1));
+
+        benchmark::DoNotOptimize(async_result.get().return_value());
+    }
+}
+BENCHMARK(BM_HandOffAsyncResult);
+
+static void BM_HandOffAsyncResultContinuation(benchmark::State& state)
+{
+    int value = 0;
+
+    for (auto _ : state)
+    {
+        AsyncResultPromise<TaskErrorCodes, int> promise;
+
+        promise.get_async_result().then([&value](TaskResult&& result) { value += result.return_value(); });
+        promise.set_result(TaskResult::success(1));
+    }
+
+    benchmark::DoNotOptimize(value);
+}
+BENCHMARK(BM_HandOffAsyncResultContinuation);
@@ -0,0 +1,34 @@
+#include <benchmark/benchmark.h>
+
+#include "CPPResult.hpp"
+
+using SEFUtility::FailureBacktrace;
+using SEFUtility::Result;
+
+using namespace SEFUtility::literals;
+
+enum class TraceErrorCodes
+{
+    SUCCESS = 0,
+    FAILURE_1 = 1000
+};
+
+//
+//  Creating a failure with backtrace capture disabled, which only records the source location, and with one
+//      in every 'range' failures capturing a backtrace.
+//
+
+static void BM_FailureBacktraceSampling(benchmark::State& state)
+{
+    FailureBacktrace::set_sampling_interval(static_cast<unsigned int>(state.range(0)));
+
+    for (auto _ : state)
+    {
+        auto result = Result<TraceErrorCodes>::failure(TraceErrorCodes::FAILURE_1, "Operation failed"_msg);
+
+        benchmark::DoNotOptimize(result);
+    }
+
+    FailureBacktrace::set_sampling_interval(0);
+}
+BENCHMARK(BM_FailureBacktraceSampling)->Arg(0)->Arg(1000)->Arg(100)->Arg(1);
@@ -0,0 +1,131 @@
+#include <benchmark/benchmark.h>
+
+#include <optional>
+#include <string>
+
+#if __has_include(<expected>)
+#include <expected>
+#endif
+
+#include "CPPResult.hpp"
+
+using SEFUtility::ResultWithReturnValue;
+
+//
+//  The same fallible parse implemented with ResultWithReturnValue and with the usual alternatives,
+//      std::expected is only measured when the benchmarks are built as C++23.
+//
+
+enum class ParseErrorCodes
+{
+    SUCCESS = 0,
+    NEGATIVE_VALUE = 1000
+};
+
+static ResultWithReturnValue<ParseErrorCodes, int> parse_with_result(int value)
+{
+    if (value < 0)
+    {
+        return (
+            ResultWithReturnValue<ParseErrorCodes, int>::failure(ParseErrorCodes::NEGATIVE_VALUE, "Negative value"));
+    }
+
+    return (ResultWithReturnValue<ParseErrorCodes, int>::success(value * 2));
+}
+
+static std::optional<int> parse_with_optional(int value)
+{
+    if (value < 0)
+    {
+        return (std::nullopt);
+    }
+
+    return (value * 2);
+}
+
+static ParseErrorCodes parse_with_error_code(int value, int& parsed_value)
+{
+    if (value < 0)
+    {
+        return (ParseErrorCodes::NEGATIVE_VALUE);
+    }
+
+    parsed_value = value * 2;
+
+    return (ParseErrorCodes::SUCCESS);
+}
+
+static void BM_BaselineResultWithReturnValue(benchmark::State& state)
+{
+    int value = static_cast<int>(state.range(0));
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(value);
+
+        auto result = parse_with_result(value);
+
+        benchmark::DoNotOptimize(result.succeeded() ? result.return_value() : 0);
+    }
+}
+BENCHMARK(BM_BaselineResultWithReturnValue)->Arg(1)->Arg(-1);
+
+static void BM_BaselineOptional(benchmark::State& state)
+{
+    int value = static_cast<int>(state.range(0));
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(value);
+
+        auto result = parse_with_optional(value);
+
+        benchmark::DoNotOptimize(result.value_or(0));
+    }
+}
+BENCHMARK(BM_BaselineOptional)->Arg(1)->Arg(-1);
+
+static void BM_BaselineErrorCode(benchmark::State& state)
+{
+    int value = static_cast<int>(state.range(0));
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(value);
+
+        int parsed_value = 0;
+        auto error_code = parse_with_error_code(value, parsed_value);
+
+        benchmark::DoNotOptimize(error_code == ParseErrorCodes::SUCCESS ? parsed_value : 0);
+    }
+}
+BENCHMARK(BM_BaselineErrorCode)->Arg(1)->Arg(-1);
+
+#if defined(__cpp_lib_expected)
+
+static std::expected<int, std::string> parse_with_expected(int value)
+{
+    if (value < 0)
+    {
+        return (std::unexpected(std::string("Negative value")));
+    }
+
+    return (value * 2);
+}
+
+static void BM_BaselineExpected(benchmark::State& state)
+{
+    int value = static_cast<int>(state.range(0));
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(value);
+
+        auto result = parse_with_expected(value);
+
+        benchmark::DoNotOptimize(result.value_or(0));
+    }
+}
+BENCHMARK(BM_BaselineExpected)->Arg(1)->Arg(-1);
+
+#endif
@@ -0,0 +1,85 @@
+#include <benchmark/benchmark.h>
+
+#include <typeinfo>
+
+#include "CPPResult.hpp"
+
+using SEFUtility::Result;
+using SEFUtility::ResultBase;
+
+using namespace SEFUtility::literals;
+
+enum class DatabaseErrorCodes
+{
+    SUCCESS = 0,
+    CONNECTION_LOST = 1000
+};
+
+enum class ServiceErrorCodes
+{
+    SUCCESS = 0,
+    REQUEST_FAILED = 1000
+};
+
+//
+//  Searching an inner error chain for a database error which sits at the innermost node.  The argument is
+//      the depth of the chain.  The first benchmark compares typeid per node, the others use the integer
+//      error domain stored in each node.
+//
+
+static Result<ServiceErrorCodes> make_chain(int64_t depth)
+{
+    auto root = Result<DatabaseErrorCodes>::failure(DatabaseErrorCodes::CONNECTION_LOST, "Connection lost"_msg);
+    auto chain = Result<ServiceErrorCodes>::failure(root, ServiceErrorCodes::REQUEST_FAILED, "Request failed"_msg);
+
+    for (int64_t i = 1; i < depth; i++)
+    {
+        chain = Result<ServiceErrorCodes>::failure(chain, ServiceErrorCodes::REQUEST_FAILED, "Request failed"_msg);
+    }
+
+    return (chain);
+}
+
+static void BM_ChainSearchTypeid(benchmark::State& state)
+{
+    auto chain = make_chain(state.range(0));
+
+    for (auto _ : state)
+    {
+        const ResultBase* found = nullptr;
+
+        for (const ResultBase* node = &chain; node != nullptr; node = node->inner_error().get())
+        {
+            if (node->error_code_type() == typeid(DatabaseErrorCodes))
+            {
+                found = node;
+                break;
+            }
+        }
+
+        benchmark::DoNotOptimize(found);
+    }
+}
+BENCHMARK(BM_ChainSearchTypeid)->RangeMultiplier(2)->Range(1, 32);
+
+static void BM_ChainSearchFindInChain(benchmark::State& state)
+{
+    auto chain = make_chain(state.range(0));
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(chain.find_in_chain<DatabaseErrorCodes>());
+    }
+}
+BENCHMARK(BM_ChainSearchFindInChain)->RangeMultiplier(2)->Range(1, 32);
+
+static void BM_ChainSearchContainsCode(benchmark::State& state)
+{
+    auto chain = make_chain(state.range(0));
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(chain.contains_code(DatabaseErrorCodes::CONNECTION_LOST));
+    }
+}
+BENCHMARK(BM_ChainSearchContainsCode)->RangeMultiplier(2)->Range(1, 32);
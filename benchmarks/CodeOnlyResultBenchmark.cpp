@@ -0,0 +1,72 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "CPPCodeOnlyResult.hpp"
+#include "CPPResult.hpp"
+
+using SEFUtility::CodeOnlyResult;
+using SEFUtility::Result;
+
+enum class PacketErrorCodes
+{
+    SUCCESS = 0,
+    TRUNCATED = 1000,
+    BAD_CHECKSUM
+};
+
+//
+//  Decoding a stream of packets where one in eight fails, with the same decoder written against Result and
+//      against CodeOnlyResult.
+//
+
+template <typename TResult>
+static TResult decode_packet(std::uint8_t length, std::uint8_t checksum)
+{
+    if (length < 4)
+    {
+        return (TResult::failure(PacketErrorCodes::TRUNCATED, "Packet of {} bytes is truncated", length));
+    }
+
+    if (checksum != 0)
+    {
+        return (TResult::failure(PacketErrorCodes::BAD_CHECKSUM, "Checksum {} is wrong", checksum));
+    }
+
+    return (TResult::success());
+}
+
+template <typename TResult>
+static void decode_stream(benchmark::State& state)
+{
+    std::vector<std::uint8_t> lengths(1024, 16);
+
+    for (std::size_t i = 0; i < lengths.size(); i += 8)
+    {
+        lengths[i] = 2;
+    }
+
+    for (auto _ : state)
+    {
+        int failures = 0;
+
+        for (std::uint8_t length : lengths)
+        {
+            failures += decode_packet<TResult>(length, 0).failed() ? 1 : 0;
+        }
+
+        benchmark::DoNotOptimize(failures);
+    }
+
+    state.SetItemsProcessed(state.iterations() * lengths.size());
+}
+
+static void BM_DecodeStreamResult(benchmark::State& state) { decode_stream<Result<PacketErrorCodes>>(state); }
+BENCHMARK(BM_DecodeStreamResult);
+
+static void BM_DecodeStreamCodeOnlyResult(benchmark::State& state)
+{
+    decode_stream<CodeOnlyResult<PacketErrorCodes>>(state);
+}
+BENCHMARK(BM_DecodeStreamCodeOnlyResult);
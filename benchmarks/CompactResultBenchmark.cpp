@@ -0,0 +1,175 @@
+#include <benchmark/benchmark.h>
+
+#include <numeric>
+#include <vector>
+
+#include "CPPCompactResult.hpp"
+
+using SEFUtility::CompactResult;
+using SEFUtility::CompactResultWithReturnValue;
+using SEFUtility::Result;
+using SEFUtility::ResultWithReturnValue;
+
+enum class ValidationErrorCodes
+{
+    SUCCESS = 0,
+    NEGATIVE_VALUE = 1000
+};
+
+//
+//  Validators returning each Result representation, called in a loop where nearly every call succeeds.
+//
+
+static Result<ValidationErrorCodes> validate_with_result(int value)
+{
+    if (value < 0)
+    {
+        return (Result<ValidationErrorCodes>::failure(ValidationErrorCodes::NEGATIVE_VALUE, "Negative value"));
+    }
+
+    return (Result<ValidationErrorCodes>::success());
+}
+
+static CompactResult<ValidationErrorCodes> validate_with_compact_result(int value)
+{
+    if (value < 0)
+    {
+        return (CompactResult<ValidationErrorCodes>::failure(ValidationErrorCodes::NEGATIVE_VALUE, "Negative value"));
+    }
+
+    return (CompactResult<ValidationErrorCodes>::success());
+}
+
+static void BM_ResultSuccessPath(benchmark::State& state)
+{
+    int value = 1;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(value);
+
+        auto result = validate_with_result(value);
+
+        benchmark::DoNotOptimize(result.succeeded());
+    }
+}
+BENCHMARK(BM_ResultSuccessPath);
+
+static void BM_CompactResultSuccessPath(benchmark::State& state)
+{
+    int value = 1;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(value);
+
+        auto result = validate_with_compact_result(value);
+
+        benchmark::DoNotOptimize(result.succeeded());
+    }
+}
+BENCHMARK(BM_CompactResultSuccessPath);
+
+static void BM_ResultFailurePath(benchmark::State& state)
+{
+    int value = -1;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(value);
+
+        auto result = validate_with_result(value);
+
+        benchmark::DoNotOptimize(result.error_code());
+    }
+}
+BENCHMARK(BM_ResultFailurePath);
+
+static void BM_CompactResultFailurePath(benchmark::State& state)
+{
+    int value = -1;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(value);
+
+        auto result = validate_with_compact_result(value);
+
+        benchmark::DoNotOptimize(result.error_code());
+    }
+}
+BENCHMARK(BM_CompactResultFailurePath);
+
+//
+//  Parsers returning a value by each representation, summing the values in a loop where every call succeeds.
+//
+
+static ResultWithReturnValue<ValidationErrorCodes, int> parse_with_result(int value)
+{
+    if (value < 0)
+    {
+        return (ResultWithReturnValue<ValidationErrorCodes, int>::failure(ValidationErrorCodes::NEGATIVE_VALUE,
+                                                                          "Negative value"));
+    }
+
+    return (ResultWithReturnValue<ValidationErrorCodes, int>::success(value * 2));
+}
+
+static CompactResultWithReturnValue<ValidationErrorCodes, int> parse_with_compact_result(int value)
+{
+    if (value < 0)
+    {
+        return (CompactResultWithReturnValue<ValidationErrorCodes, int>::failure(ValidationErrorCodes::NEGATIVE_VALUE,
+                                                                                 "Negative value"));
+    }
+
+    return (CompactResultWithReturnValue<ValidationErrorCodes, int>::success(value * 2));
+}
+
+static void BM_ResultWithReturnValueLoop(benchmark::State& state)
+{
+    std::vector<int> values(64);
+
+    std::iota(values.begin(), values.end(), 0);
+
+    for (auto _ : state)
+    {
+        int sum = 0;
+
+        benchmark::DoNotOptimize(values.data());
+
+        for (int value : values)
+        {
+            auto result = parse_with_result(value);
+
+            sum += result.succeeded() ? result.return_value() : 0;
+        }
+
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_ResultWithReturnValueLoop);
+
+static void BM_CompactResultWithReturnValueLoop(benchmark::State& state)
+{
+    std::vector<int> values(64);
+
+    std::iota(values.begin(), values.end(), 0);
+
+    for (auto _ : state)
+    {
+        int sum = 0;
+
+        benchmark::DoNotOptimize(values.data());
+
+        for (int value : values)
+        {
+            auto result = parse_with_compact_result(value);
+
+            sum += result.succeeded() ? result.return_value() : 0;
+        }
+
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_CompactResultWithReturnValueLoop);
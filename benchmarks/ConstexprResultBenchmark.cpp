@@ -0,0 +1,98 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "CPPConstexprResult.hpp"
+#include "CPPResult.hpp"
+
+using SEFUtility::ConstexprResult;
+using SEFUtility::Result;
+
+enum class LimitErrorCodes
+{
+    SUCCESS = 0,
+    BELOW_MINIMUM = 1000,
+    ABOVE_MAXIMUM
+};
+
+//
+//  Validating a table of limits at runtime where one entry in eight fails, with the same validator written
+//      against Result and against ConstexprResult, and as a plain comparison for reference.
+//
+
+template <typename TResult>
+static TResult validate_limit(int limit)
+{
+    if (limit < 0)
+    {
+        return (TResult::failure(LimitErrorCodes::BELOW_MINIMUM, "Limit is below the minimum"));
+    }
+
+    if (limit > 1000)
+    {
+        return (TResult::failure(LimitErrorCodes::ABOVE_MAXIMUM, "Limit is above the maximum"));
+    }
+
+    return (TResult::success());
+}
+
+static std::vector<int> make_limits()
+{
+    std::vector<int> limits(1024, 100);
+
+    for (std::size_t i = 0; i < limits.size(); i += 8)
+    {
+        limits[i] = -1;
+    }
+
+    return (limits);
+}
+
+template <typename TResult>
+static void validate_limits(benchmark::State& state)
+{
+    std::vector<int> limits = make_limits();
+
+    for (auto _ : state)
+    {
+        int failures = 0;
+
+        for (int limit : limits)
+        {
+            failures += validate_limit<TResult>(limit).failed() ? 1 : 0;
+        }
+
+        benchmark::DoNotOptimize(failures);
+    }
+
+    state.SetItemsProcessed(state.iterations() * limits.size());
+}
+
+static void BM_ValidateLimitsResult(benchmark::State& state) { validate_limits<Result<LimitErrorCodes>>(state); }
+BENCHMARK(BM_ValidateLimitsResult);
+
+static void BM_ValidateLimitsConstexprResult(benchmark::State& state)
+{
+    validate_limits<ConstexprResult<LimitErrorCodes>>(state);
+}
+BENCHMARK(BM_ValidateLimitsConstexprResult);
+
+static void BM_ValidateLimitsComparison(benchmark::State& state)
+{
+    std::vector<int> limits = make_limits();
+
+    for (auto _ : state)
+    {
+        int failures = 0;
+
+        for (int limit : limits)
+        {
+            failures += ((limit < 0) || (limit > 1000)) ? 1 : 0;
+        }
+
+        benchmark::DoNotOptimize(failures);
+    }
+
+    state.SetItemsProcessed(state.iterations() * limits.size());
+}
+BENCHMARK(BM_ValidateLimitsComparison);
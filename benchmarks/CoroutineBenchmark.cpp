@@ -0,0 +1,104 @@
+#include <benchmark/benchmark.h>
+
+#include "CPPResultCoroutine.hpp"
+
+using SEFUtility::Result;
+using SEFUtility::ResultWithReturnValue;
+
+using namespace SEFUtility::literals;
+
+enum class ConfigErrorCodes
+{
+    SUCCESS = 0,
+    OUT_OF_RANGE = 1000,
+    INVALID_COMBINATION
+};
+
+typedef ResultWithReturnValue<ConfigErrorCodes, int> IntResult;
+
+//
+//  Validating a pair of settings through three fallible steps, written with explicit checks and as a
+//      coroutine.  The argument selects whether the first step fails.
+//
+
+static IntResult read_setting(int value)
+{
+    if (value < 0)
+    {
+        return (IntResult::failure(ConfigErrorCodes::OUT_OF_RANGE, "Setting is negative"_msg));
+    }
+
+    return (IntResult::success(value));
+}
+
+static Result<ConfigErrorCodes> check_combination(int first, int second)
+{
+    if (first + second > 1000)
+    {
+        return (Result<ConfigErrorCodes>::failure(ConfigErrorCodes::INVALID_COMBINATION, "Settings too large"_msg));
+    }
+
+    return (Result<ConfigErrorCodes>::success());
+}
+
+static IntResult validate_explicit(int first, int second)
+{
+    auto first_value = read_setting(first);
+
+    if (first_value.failed())
+    {
+        return (IntResult(std::move(first_value)));
+    }
+
+    auto second_value = read_setting(second);
+
+    if (second_value.failed())
+    {
+        return (IntResult(std::move(second_value)));
+    }
+
+    auto combination = check_combination(first_value.return_value(), second_value.return_value());
+
+    if (combination.failed())
+    {
+        return (IntResult(std::move(combination)));
+    }
+
+    return (IntResult::success(first_value.return_value() + second_value.return_value()));
+}
+
+static IntResult validate_coroutine(int first, int second)
+{
+    int first_value = co_await read_setting(first);
+    int second_value = co_await read_setting(second);
+
+    co_await check_combination(first_value, second_value);
+
+    co_return first_value + second_value;
+}
+
+static void BM_ValidateExplicitChecks(benchmark::State& state)
+{
+    int first = state.range(0) ? -1 : 10;
+
+    for (auto _ : state)
+    {
+        auto result = validate_explicit(first, 20);
+
+        benchmark::DoNotOptimize(result.error_code());
+    }
+}
+BENCHMARK(BM_ValidateExplicitChecks)->Arg(0)->Arg(1);
+
+static void BM_ValidateCoroutine(benchmark::State& state)
+{
+    int first = state.range(0) ? -1 : 10;
+
+    for (auto _ : state)
+    {
+        auto result = validate_coroutine(first, 20);
+
+        benchmark::DoNotOptimize(result.error_code());
+    }
+}
+BENCHMARK(BM_ValidateCoroutine)->Arg(0)->Arg(1);
@@ -0,0 +1,128 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "CPPResultBatch.hpp"
+
+using SEFUtility::ErrorCodeKernels;
+using SEFUtility::Result;
+using SEFUtility::ResultBatch;
+
+using namespace SEFUtility::literals;
+
+enum class ScanErrorCodes
+{
+    SUCCESS = 0,
+    TIMEOUT = 1000,
+    REFUSED
+};
+
+//
+//  Counting the failures with a given error code in a batch of 10000 outcomes where one in a hundred failed,
+//      first by looping over a vector of Results and then with each kernel implementation over the packed
+//      error codes of a ResultBatch.
+//
+
+static constexpr int64_t BATCH_SIZE = 10000;
+
+static Result<ScanErrorCodes> scan_outcome(int64_t index)
+{
+    if (index % 100 == 0)
+    {
+        return (Result<ScanErrorCodes>::failure((index % 200 == 0) ? ScanErrorCodes::TIMEOUT : ScanErrorCodes::REFUSED,
+                                                "Operation failed"_msg));
+    }
+
+    return (Result<ScanErrorCodes>::success());
+}
+
+static std::vector<Result<ScanErrorCodes>> scan_results()
+{
+    std::vector<Result<ScanErrorCodes>> results;
+
+    for (int64_t i = 0; i < BATCH_SIZE; i++)
+    {
+        results.push_back(scan_outcome(i));
+    }
+
+    return (results);
+}
+
+static void BM_ScanVectorOfResults(benchmark::State& state)
+{
+    std::vector<Result<ScanErrorCodes>> results = scan_results();
+
+    for (auto _ : state)
+    {
+        size_t timeouts = 0;
+
+        for (const auto& result : results)
+        {
+            timeouts += (result.failed() && (result.error_code_value() == int(ScanErrorCodes::TIMEOUT))) ? 1 : 0;
+        }
+
+        benchmark::DoNotOptimize(timeouts);
+    }
+
+    state.SetItemsProcessed(state.iterations() * BATCH_SIZE);
+}
+BENCHMARK(BM_ScanVectorOfResults);
+
+static void scan_with_kernel(benchmark::State& state, const ErrorCodeKernels::Implementation* implementation)
+{
+    if (implementation == nullptr)
+    {
+        state.SkipWithError("Instruction set not supported");
+        return;
+    }
+
+    auto batch = ResultBatch<ScanErrorCodes>::from_results(scan_results());
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(
+            implementation->count_equal_(batch.error_codes(), BATCH_SIZE, int32_t(ScanErrorCodes::TIMEOUT)));
+    }
+
+    state.SetItemsProcessed(state.iterations() * BATCH_SIZE);
+}
+
+static void BM_ScanKernelScalar(benchmark::State& state) { scan_with_kernel(state, &ErrorCodeKernels::scalar()); }
+BENCHMARK(BM_ScanKernelScalar);
+
+static void BM_ScanKernelSSE2(benchmark::State& state) { scan_with_kernel(state, ErrorCodeKernels::sse2()); }
+BENCHMARK(BM_ScanKernelSSE2);
+
+static void BM_ScanKernelAVX2(benchmark::State& state) { scan_with_kernel(state, ErrorCodeKernels::avx2()); }
+BENCHMARK(BM_ScanKernelAVX2);
+
+//  Collecting the indices of one error code and finding the first failure through ResultBatch.
+
+static void BM_ScanBatchIndicesWithErrorCode(benchmark::State& state)
+{
+    auto batch = ResultBatch<ScanErrorCodes>::from_results(scan_results());
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(batch.indices_with_error_code(ScanErrorCodes::TIMEOUT));
+    }
+
+    state.SetItemsProcessed(state.iterations() * BATCH_SIZE);
+}
+BENCHMARK(BM_ScanBatchIndicesWithErrorCode);
+
+static void BM_ScanBatchFirstFailure(benchmark::State& state)
+{
+    ResultBatch<ScanErrorCodes> batch(BATCH_SIZE);
+
+    batch.set(BATCH_SIZE - 1, scan_outcome(0));
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(batch.first_failure());
+    }
+
+    state.SetItemsProcessed(state.iterations() * BATCH_SIZE);
+}
+BENCHMARK(BM_ScanBatchFirstFailure);
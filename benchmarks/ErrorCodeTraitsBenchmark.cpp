@@ -0,0 +1,72 @@
+#include <benchmark/benchmark.h>
+
+#include <map>
+#include <string>
+#include <typeindex>
+#include <utility>
+
+#include "CPPResult.hpp"
+
+using SEFUtility::ErrorCodeDescription;
+using SEFUtility::ErrorSeverity;
+using SEFUtility::Result;
+using SEFUtility::ResultBase;
+
+using namespace SEFUtility::literals;
+
+enum class ServiceErrorCodes
+{
+    SUCCESS = 0,
+    UNAVAILABLE = 1000,
+    THROTTLED,
+    REJECTED
+};
+
+template <>
+struct SEFUtility::ErrorCodeTraits<ServiceErrorCodes>
+{
+    static constexpr ErrorCodeDescription codes[] = {
+        CPPRESULT_ERROR_CODE(ServiceErrorCodes::UNAVAILABLE, ErrorSeverity::FAILURE, true),
+        CPPRESULT_ERROR_CODE(ServiceErrorCodes::THROTTLED, ErrorSeverity::WARNING, true),
+        CPPRESULT_ERROR_CODE(ServiceErrorCodes::REJECTED)};
+};
+
+//
+//  Naming the error code of an inner error known only through ResultBase and deciding whether to retry, first
+//      with the RTTI and map lookup the compile time metadata replaces and then with the metadata itself.
+//
+
+static void BM_ErrorCodeNameTypeidMap(benchmark::State& state)
+{
+    std::map<std::pair<std::type_index, int>, std::pair<std::string, bool>> names{
+        {{typeid(ServiceErrorCodes), 1000}, {"UNAVAILABLE", true}},
+        {{typeid(ServiceErrorCodes), 1001}, {"THROTTLED", true}},
+        {{typeid(ServiceErrorCodes), 1002}, {"REJECTED", false}}};
+
+    auto result = Result<ServiceErrorCodes>::failure(ServiceErrorCodes::THROTTLED, "Throttled"_msg);
+    const ResultBase& failure = result;
+
+    for (auto _ : state)
+    {
+        const auto& entry = names.at({std::type_index(failure.error_code_type()), failure.error_code_value()});
+
+        benchmark::DoNotOptimize(entry.first.data());
+        benchmark::DoNotOptimize(entry.second);
+    }
+}
+BENCHMARK(BM_ErrorCodeNameTypeidMap);
+
+static void BM_ErrorCodeNameMetadata(benchmark::State& state)
+{
+    auto result = Result<ServiceErrorCodes>::failure(ServiceErrorCodes::THROTTLED, "Throttled"_msg);
+    const ResultBase& failure = result;
+
+    for (auto _ : state)
+    {
+        const ErrorCodeDescription& description = failure.error_code_description();
+
+        benchmark::DoNotOptimize(description.name().data());
+        benchmark::DoNotOptimize(description.retryable());
+    }
+}
+BENCHMARK(BM_ErrorCodeNameMetadata);
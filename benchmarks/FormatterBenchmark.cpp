@@ -0,0 +1,95 @@
+#include <benchmark/benchmark.h>
+
+#include <iterator>
+#include <string>
+
+#include "CPPResult.hpp"
+
+using SEFUtility::Result;
+using SEFUtility::ResultBase;
+
+using namespace SEFUtility::literals;
+
+enum class LogErrorCodes
+{
+    SUCCESS = 0,
+    CONNECTION_LOST = 1000,
+    QUERY_FAILED,
+    REQUEST_FAILED
+};
+
+template <>
+struct SEFUtility::ErrorCodeTraits<LogErrorCodes>
+{
+    static constexpr ErrorCodeDescription codes[] = {CPPRESULT_ERROR_CODE(LogErrorCodes::CONNECTION_LOST),
+                                                     CPPRESULT_ERROR_CODE(LogErrorCodes::QUERY_FAILED),
+                                                     CPPRESULT_ERROR_CODE(LogErrorCodes::REQUEST_FAILED)};
+};
+
+//
+//  Rendering a three level failure chain for a log line, first by concatenating strings built from each node
+//      and then by formatting the Result into a reused buffer.
+//
+
+static Result<LogErrorCodes> log_chain()
+{
+    auto root_cause = Result<LogErrorCodes>::failure(LogErrorCodes::CONNECTION_LOST, "Connection to {} lost", 7);
+    auto middle = Result<LogErrorCodes>::failure(root_cause, LogErrorCodes::QUERY_FAILED, "Query failed"_msg);
+
+    return (Result<LogErrorCodes>::failure(middle, LogErrorCodes::REQUEST_FAILED, "Request {} failed", 42));
+}
+
+static void BM_RenderChainConcatenation(benchmark::State& state)
+{
+    auto result = log_chain();
+
+    for (auto _ : state)
+    {
+        std::string text;
+
+        for (const ResultBase* node = &result; node != nullptr; node = node->inner_error().get())
+        {
+            if (!text.empty())
+            {
+                text += " <- ";
+            }
+
+            text += std::string(node->error_code_name()) + ": " + std::string(node->message());
+        }
+
+        benchmark::DoNotOptimize(text.data());
+    }
+}
+BENCHMARK(BM_RenderChainConcatenation);
+
+static void BM_RenderChainFormatter(benchmark::State& state)
+{
+    auto result = log_chain();
+    fmt::memory_buffer buffer;
+
+    for (auto _ : state)
+    {
+        buffer.clear();
+
+        fmt::format_to(std::back_inserter(buffer), "{}", result);
+
+        benchmark::DoNotOptimize(buffer.data());
+    }
+}
+BENCHMARK(BM_RenderChainFormatter);
+
+static void BM_RenderChainFormatterVerbose(benchmark::State& state)
+{
+    auto result = log_chain();
+    fmt::memory_buffer buffer;
+
+    for (auto _ : state)
+    {
+        buffer.clear();
+
+        fmt::format_to(std::back_inserter(buffer), "{:v}", result);
+
+        benchmark::DoNotOptimize(buffer.data());
+    }
+}
+BENCHMARK(BM_RenderChainFormatterVerbose);
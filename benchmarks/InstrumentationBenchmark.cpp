@@ -0,0 +1,55 @@
+#include <benchmark/benchmark.h>
+
+#include "CPPResult.hpp"
+
+using SEFUtility::ErrorCodeMetadata;
+using SEFUtility::FailureCounters;
+using SEFUtility::Result;
+
+using namespace SEFUtility::literals;
+
+enum class CountedErrorCodes
+{
+    SUCCESS = 0,
+    FAILURE_1 = 1000,
+    FAILURE_2
+};
+
+//
+//  The cost instrumentation adds to each failure is a call to FailureCounters::record(), measured directly here
+//      so it can be compared with creating a failure in the same run.  Creating the failure includes the hook
+//      only when the benchmarks are built with CPPRESULT_ENABLE_INSTRUMENTATION.
+//
+
+static void BM_FailureCounterRecord(benchmark::State& state)
+{
+    const SEFUtility::ErrorDomainId domain = ErrorCodeMetadata<CountedErrorCodes>::domain_id();
+
+    for (auto _ : state)
+    {
+        FailureCounters::record(domain, int(CountedErrorCodes::FAILURE_1));
+    }
+}
+BENCHMARK(BM_FailureCounterRecord)->ThreadRange(1, 8);
+
+static void BM_FailureCounterCreateFailure(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        auto result = Result<CountedErrorCodes>::failure(CountedErrorCodes::FAILURE_2, "Operation failed"_msg);
+
+        benchmark::DoNotOptimize(result);
+    }
+}
+BENCHMARK(BM_FailureCounterCreateFailure)->ThreadRange(1, 8);
+
+static void BM_FailureCounterSnapshot(benchmark::State& state)
+{
+    FailureCounters::record(ErrorCodeMetadata<CountedErrorCodes>::domain_id(), int(CountedErrorCodes::FAILURE_1));
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(FailureCounters::snapshot());
+    }
+}
+BENCHMARK(BM_FailureCounterSnapshot);
@@ -0,0 +1,69 @@
+#include <benchmark/benchmark.h>
+
+#include "CPPResult.hpp"
+
+using SEFUtility::Result;
+
+enum class ParseErrorCodes
+{
+    SUCCESS = 0,
+    NOT_A_NUMBER = 1000,
+    OUT_OF_RANGE
+};
+
+//
+//  Failures constructed and then discarded after only inspecting the error code, as happens in
+//      parse-attempt fallbacks.
+//
+
+static void BM_EagerFailureDiscarded(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        auto result = Result<ParseErrorCodes>::failure(ParseErrorCodes::NOT_A_NUMBER,
+                                                       "Token '{}' at offset {} is not a number", "abc", 1234);
+
+        benchmark::DoNotOptimize(result.error_code());
+    }
+}
+BENCHMARK(BM_EagerFailureDiscarded);
+
+static void BM_LazyFailureDiscarded(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        auto result = Result<ParseErrorCodes>::lazy_failure(ParseErrorCodes::NOT_A_NUMBER,
+                                                            "Token '{}' at offset {} is not a number", "abc", 1234);
+
+        benchmark::DoNotOptimize(result.error_code());
+    }
+}
+BENCHMARK(BM_LazyFailureDiscarded);
+
+//
+//  Failures whose message is always read, the worst case for lazy formatting.
+//
+
+static void BM_EagerFailureMessageRead(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        auto result = Result<ParseErrorCodes>::failure(ParseErrorCodes::NOT_A_NUMBER,
+                                                       "Token '{}' at offset {} is not a number", "abc", 1234);
+
+        benchmark::DoNotOptimize(result.message().data());
+    }
+}
+BENCHMARK(BM_EagerFailureMessageRead);
+
+static void BM_LazyFailureMessageRead(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        auto result = Result<ParseErrorCodes>::lazy_failure(ParseErrorCodes::NOT_A_NUMBER,
+                                                            "Token '{}' at offset {} is not a number", "abc", 1234);
+
+        benchmark::DoNotOptimize(result.message().data());
+    }
+}
+BENCHMARK(BM_LazyFailureMessageRead);
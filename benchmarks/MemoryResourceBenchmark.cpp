@@ -0,0 +1,62 @@
+#include <benchmark/benchmark.h>
+
+#include <memory_resource>
+#include <vector>
+
+#include "CPPResult.hpp"
+
+using SEFUtility::Result;
+using SEFUtility::ScopedResultMemoryResource;
+
+enum class StorageErrorCodes
+{
+    SUCCESS = 0,
+    READ_FAILED = 1000,
+    RECORD_CORRUPT
+};
+
+enum class RequestErrorCodes
+{
+    SUCCESS = 0,
+    REQUEST_FAILED = 2000
+};
+
+//
+//  A burst of wrapped failures with messages too long for the small string optimization, as produced
+//      when a dependency starts failing every request.  The argument is the number of failures held at once.
+//
+
+static void ErrorBurst(benchmark::State& state)
+{
+    std::vector<Result<RequestErrorCodes>> failures;
+
+    failures.reserve(state.range(0));
+
+    for (auto _ : state)
+    {
+        for (int64_t i = 0; i < state.range(0); i++)
+        {
+            auto inner = Result<StorageErrorCodes>::failure(StorageErrorCodes::RECORD_CORRUPT,
+                                                            "Record {} failed its checksum while being read", i);
+
+            failures.emplace_back(Result<RequestErrorCodes>::failure(inner, RequestErrorCodes::REQUEST_FAILED,
+                                                                     "Request {} could not be completed", i));
+        }
+
+        benchmark::DoNotOptimize(failures.data());
+        failures.clear();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_ErrorBurstDefaultResource(benchmark::State& state) { ErrorBurst(state); }
+BENCHMARK(BM_ErrorBurstDefaultResource)->Arg(16)->Arg(256);
+
+static void BM_ErrorBurstGlobalHeap(benchmark::State& state)
+{
+    ScopedResultMemoryResource heap_resource(std::pmr::new_delete_resource());
+
+    ErrorBurst(state);
+}
+BENCHMARK(BM_ErrorBurstGlobalHeap)->Arg(16)->Arg(256);
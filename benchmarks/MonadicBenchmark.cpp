@@ -0,0 +1,88 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include "CPPResult.hpp"
+
+using SEFUtility::ResultWithReturnValue;
+
+enum class PipelineErrorCodes
+{
+    SUCCESS = 0,
+    EMPTY_INPUT = 1000,
+    TOO_LONG
+};
+
+typedef ResultWithReturnValue<PipelineErrorCodes, std::string> StringResult;
+
+//
+//  A three step pipeline over a string payload long enough to allocate, written once with explicit
+//      checks and once with the monadic operations.
+//
+
+static StringResult read_input(const std::string& input)
+{
+    if (input.empty())
+    {
+        return (StringResult::failure(PipelineErrorCodes::EMPTY_INPUT, "Input is empty"));
+    }
+
+    return (StringResult::success(input));
+}
+
+static StringResult trim(std::string&& text)
+{
+    text.erase(0, text.find_first_not_of(' '));
+
+    return (StringResult::success(std::move(text)));
+}
+
+static StringResult check_length(std::string&& text)
+{
+    if (text.size() > 128)
+    {
+        return (StringResult::failure(PipelineErrorCodes::TOO_LONG, "Input is {} characters long", text.size()));
+    }
+
+    return (StringResult::success(std::move(text)));
+}
+
+static const std::string INPUT = "      a payload long enough to defeat the small string optimization";
+
+static void BM_PipelineExplicitChecks(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        auto input = read_input(INPUT);
+
+        if (input.failed())
+        {
+            continue;
+        }
+
+        auto trimmed = trim(std::string(input.return_value()));
+
+        if (trimmed.failed())
+        {
+            continue;
+        }
+
+        auto checked = check_length(std::string(trimmed.return_value()));
+
+        benchmark::DoNotOptimize(checked.return_value().size());
+    }
+}
+BENCHMARK(BM_PipelineExplicitChecks);
+
+static void BM_PipelineMonadic(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        auto length = read_input(INPUT).and_then(trim).and_then(check_length).transform([](std::string&& text) {
+            return (text.size());
+        });
+
+        benchmark::DoNotOptimize(length.return_value());
+    }
+}
+BENCHMARK(BM_PipelineMonadic);
@@ -0,0 +1,77 @@
+#include <benchmark/benchmark.h>
+
+#include <mutex>
+#include <vector>
+
+#include "CPPResultAggregator.hpp"
+
+using SEFUtility::FailureCollector;
+using SEFUtility::FirstFailureLatch;
+using SEFUtility::Result;
+
+using namespace SEFUtility::literals;
+
+enum class FanOutErrorCodes
+{
+    SUCCESS = 0,
+    TASK_FAILED = 1000
+};
+
+//
+//  Workers on 1 to N threads each reporting a stream of task results where one in a hundred failed, first into
+//      a mutex protected vector and then into the lock free latch and collector.
+//
+
+static Result<FanOutErrorCodes> fan_out_task(int task)
+{
+    if (task % 100 == 0)
+    {
+        return (Result<FanOutErrorCodes>::failure(FanOutErrorCodes::TASK_FAILED, "Task failed"_msg));
+    }
+
+    return (Result<FanOutErrorCodes>::success());
+}
+
+static void BM_FanOutMutexVector(benchmark::State& state)
+{
+    static std::mutex mutex;
+    static std::vector<Result<FanOutErrorCodes>> results;
+
+    int task = 0;
+
+    for (auto _ : state)
+    {
+        Result<FanOutErrorCodes> result = fan_out_task(task++);
+
+        std::lock_guard<std::mutex> lock(mutex);
+
+        if (results.size() == 10000)
+        {
+            results.clear();
+        }
+
+        results.push_back(std::move(result));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FanOutMutexVector)->ThreadRange(1, 16)->UseRealTime();
+
+static void BM_FanOutLatchAndCollector(benchmark::State& state)
+{
+    static FirstFailureLatch latch;
+    static FailureCollector collector(64);
+
+    int task = 0;
+
+    for (auto _ : state)
+    {
+        Result<FanOutErrorCodes> result = fan_out_task(task++);
+
+        latch.offer(result);
+        collector.offer(result);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FanOutLatchAndCollector)->ThreadRange(1, 16)->UseRealTime();
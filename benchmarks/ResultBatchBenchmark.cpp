@@ -0,0 +1,77 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "CPPResultBatch.hpp"
+
+using SEFUtility::Result;
+using SEFUtility::ResultBatch;
+
+using namespace SEFUtility::literals;
+
+enum class BulkErrorCodes
+{
+    SUCCESS = 0,
+    WRITE_FAILED = 1000
+};
+
+//
+//  Recording the outcomes of a batch of operations and then deciding whether the batch failed, held as a
+//      vector of Results and as a ResultBatch.  The first argument is the batch size, the second the number
+//      of operations per failure with zero meaning none fail.
+//
+
+static Result<BulkErrorCodes> bulk_operation(int64_t index, int64_t failure_interval)
+{
+    if ((failure_interval != 0) && (index % failure_interval == 0))
+    {
+        return (Result<BulkErrorCodes>::failure(BulkErrorCodes::WRITE_FAILED, "Write failed"_msg));
+    }
+
+    return (Result<BulkErrorCodes>::success());
+}
+
+static void BM_BatchVectorOfResults(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        std::vector<Result<BulkErrorCodes>> results;
+
+        results.reserve(state.range(0));
+
+        for (int64_t i = 0; i < state.range(0); i++)
+        {
+            results.push_back(bulk_operation(i, state.range(1)));
+        }
+
+        size_t failed = 0;
+
+        for (const auto& result : results)
+        {
+            failed += result.failed() ? 1 : 0;
+        }
+
+        benchmark::DoNotOptimize(failed);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BatchVectorOfResults)->Args({10000, 0})->Args({10000, 100});
+
+static void BM_BatchResultBatch(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        ResultBatch<BulkErrorCodes> batch(state.range(0));
+
+        for (int64_t i = 0; i < state.range(0); i++)
+        {
+            batch.set(i, bulk_operation(i, state.range(1)));
+        }
+
+        benchmark::DoNotOptimize(batch.count_failed());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BatchResultBatch)->Args({10000, 0})->Args({10000, 100});
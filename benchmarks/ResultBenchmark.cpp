@@ -0,0 +1,315 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <string>
+
+#include "CPPResult.hpp"
+
+using SEFUtility::Result;
+using SEFUtility::ResultWithReturnRef;
+using SEFUtility::ResultWithReturnSharedPtr;
+using SEFUtility::ResultWithReturnUniquePtr;
+using SEFUtility::ResultWithReturnValue;
+
+enum class BenchmarkErrorCodes
+{
+    SUCCESS = 0,
+    FAILURE_1 = 1000,
+    FAILURE_2
+};
+
+//
+//  Builds a failure whose inner error chain is depth nodes deep.
+//
+
+static Result<BenchmarkErrorCodes> make_chain(int64_t depth)
+{
+    auto result = Result<BenchmarkErrorCodes>::failure(BenchmarkErrorCodes::FAILURE_1, "root cause");
+
+    for (int64_t i = 1; i < depth; i++)
+    {
+        result = Result<BenchmarkErrorCodes>::failure(result, BenchmarkErrorCodes::FAILURE_2, "wrapped");
+    }
+
+    return (result);
+}
+
+//
+//  Factories
+//
+
+static void BM_ResultSuccess(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        auto result = Result<BenchmarkErrorCodes>::success();
+
+        benchmark::DoNotOptimize(result);
+    }
+}
+BENCHMARK(BM_ResultSuccess);
+
+static void BM_ResultFailure(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        auto result = Result<BenchmarkErrorCodes>::failure(BenchmarkErrorCodes::FAILURE_1, "failure message");
+
+        benchmark::DoNotOptimize(result);
+    }
+}
+BENCHMARK(BM_ResultFailure);
+
+static void BM_ResultFailureLongMessage(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        auto result = Result<BenchmarkErrorCodes>::failure(BenchmarkErrorCodes::FAILURE_1,
+                                                           "failure message too long for the small string buffer");
+
+        benchmark::DoNotOptimize(result);
+    }
+}
+BENCHMARK(BM_ResultFailureLongMessage);
+
+static void BM_ResultFailureFormatted(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        auto result = Result<BenchmarkErrorCodes>::failure(BenchmarkErrorCodes::FAILURE_1,
+                                                           "failure {} of {} at {}", 3, 7, "stage two");
+
+        benchmark::DoNotOptimize(result);
+    }
+}
+BENCHMARK(BM_ResultFailureFormatted);
+
+static void BM_ResultWrapInnerError(benchmark::State& state)
+{
+    auto inner_error = make_chain(state.range(0));
+
+    for (auto _ : state)
+    {
+        auto result = Result<BenchmarkErrorCodes>::failure(inner_error, BenchmarkErrorCodes::FAILURE_2, "wrapped");
+
+        benchmark::DoNotOptimize(result);
+    }
+}
+BENCHMARK(BM_ResultWrapInnerError)->Arg(1)->Arg(4)->Arg(16)->Arg(64);
+
+static void BM_ResultWithReturnValueSuccess(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        auto result = ResultWithReturnValue<BenchmarkErrorCodes, int>::success(42);
+
+        benchmark::DoNotOptimize(result);
+    }
+}
+BENCHMARK(BM_ResultWithReturnValueSuccess);
+
+static void BM_ResultWithReturnUniquePtrSuccess(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        auto result = ResultWithReturnUniquePtr<BenchmarkErrorCodes, int>::success(std::make_unique<int>(42));
+
+        benchmark::DoNotOptimize(result);
+    }
+}
+BENCHMARK(BM_ResultWithReturnUniquePtrSuccess);
+
+//
+//  Accessors
+//
+
+static void BM_ResultAccessors(benchmark::State& state)
+{
+    auto result = make_chain(2);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(result.succeeded());
+        benchmark::DoNotOptimize(result.failed());
+        benchmark::DoNotOptimize(result.error_code());
+        benchmark::DoNotOptimize(result.message().size());
+        benchmark::DoNotOptimize(result.inner_error().get());
+    }
+}
+BENCHMARK(BM_ResultAccessors);
+
+static void BM_ResultBaseErrorCodeValue(benchmark::State& state)
+{
+    auto result = make_chain(1);
+    const SEFUtility::ResultBase& base = result;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(base.error_code_value());
+    }
+}
+BENCHMARK(BM_ResultBaseErrorCodeValue);
+
+static void BM_ResultWalkInnerErrors(benchmark::State& state)
+{
+    auto result = make_chain(state.range(0));
+
+    for (auto _ : state)
+    {
+        int sum = 0;
+
+        for (const SEFUtility::ResultBase* node = &result; node != nullptr; node = node->inner_error().get())
+        {
+            sum += node->error_code_value();
+        }
+
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_ResultWalkInnerErrors)->Arg(1)->Arg(4)->Arg(16)->Arg(64);
+
+//
+//  Copy and assignment
+//
+
+static void BM_ResultCopy(benchmark::State& state)
+{
+    auto result = make_chain(state.range(0));
+
+    for (auto _ : state)
+    {
+        Result<BenchmarkErrorCodes> copy(result);
+
+        benchmark::DoNotOptimize(copy);
+    }
+}
+BENCHMARK(BM_ResultCopy)->Arg(1)->Arg(4)->Arg(16)->Arg(64);
+
+static void BM_ResultAssign(benchmark::State& state)
+{
+    auto result = make_chain(state.range(0));
+    auto target = Result<BenchmarkErrorCodes>::success();
+
+    for (auto _ : state)
+    {
+        target = result;
+
+        benchmark::DoNotOptimize(target);
+    }
+}
+BENCHMARK(BM_ResultAssign)->Arg(1)->Arg(4)->Arg(16)->Arg(64);
+
+static void BM_ResultWithReturnValueCopy(benchmark::State& state)
+{
+    auto result = ResultWithReturnValue<BenchmarkErrorCodes, std::string>::success(std::string("returned value"));
+
+    for (auto _ : state)
+    {
+        ResultWithReturnValue<BenchmarkErrorCodes, std::string> copy(result);
+
+        benchmark::DoNotOptimize(copy);
+    }
+}
+BENCHMARK(BM_ResultWithReturnValueCopy);
+
+static void BM_ResultWithReturnValueAssign(benchmark::State& state)
+{
+    auto result = ResultWithReturnValue<BenchmarkErrorCodes, std::string>::success(std::string("returned value"));
+    auto target = ResultWithReturnValue<BenchmarkErrorCodes, std::string>::success(std::string());
+
+    for (auto _ : state)
+    {
+        target = result;
+
+        benchmark::DoNotOptimize(target);
+    }
+}
+BENCHMARK(BM_ResultWithReturnValueAssign);
+
+static void BM_ResultWithReturnValueMove(benchmark::State& state)
+{
+    auto result = ResultWithReturnValue<BenchmarkErrorCodes, std::string>::success(std::string("returned value"));
+
+    for (auto _ : state)
+    {
+        ResultWithReturnValue<BenchmarkErrorCodes, std::string> moved(std::move(result));
+
+        benchmark::DoNotOptimize(moved);
+
+        result = std::move(moved);
+    }
+}
+BENCHMARK(BM_ResultWithReturnValueMove);
+
+static void BM_ResultWithReturnRefCopy(benchmark::State& state)
+{
+    std::string value("returned value");
+    auto result = ResultWithReturnRef<BenchmarkErrorCodes, std::string>(value);
+
+    for (auto _ : state)
+    {
+        ResultWithReturnRef<BenchmarkErrorCodes, std::string> copy(result);
+
+        benchmark::DoNotOptimize(copy);
+    }
+}
+BENCHMARK(BM_ResultWithReturnRefCopy);
+
+static void BM_ResultWithReturnRefAssign(benchmark::State& state)
+{
+    std::string value("returned value");
+    auto result = ResultWithReturnRef<BenchmarkErrorCodes, std::string>(value);
+    auto target = ResultWithReturnRef<BenchmarkErrorCodes, std::string>(value);
+
+    for (auto _ : state)
+    {
+        target = result;
+
+        benchmark::DoNotOptimize(target);
+    }
+}
+BENCHMARK(BM_ResultWithReturnRefAssign);
+
+static void BM_ResultWithReturnUniquePtrMove(benchmark::State& state)
+{
+    auto result = ResultWithReturnUniquePtr<BenchmarkErrorCodes, int>::success(std::make_unique<int>(42));
+
+    for (auto _ : state)
+    {
+        ResultWithReturnUniquePtr<BenchmarkErrorCodes, int> moved(std::move(result));
+
+        benchmark::DoNotOptimize(moved);
+
+        result = std::move(moved);
+    }
+}
+BENCHMARK(BM_ResultWithReturnUniquePtrMove);
+
+static void BM_ResultWithReturnSharedPtrCopy(benchmark::State& state)
+{
+    auto value = std::make_shared<std::string>("returned value");
+    auto result = ResultWithReturnSharedPtr<BenchmarkErrorCodes, std::string>(value);
+
+    for (auto _ : state)
+    {
+        ResultWithReturnSharedPtr<BenchmarkErrorCodes, std::string> copy(result);
+
+        benchmark::DoNotOptimize(copy);
+    }
+}
+BENCHMARK(BM_ResultWithReturnSharedPtrCopy);
+
+static void BM_ResultWithReturnSharedPtrAssign(benchmark::State& state)
+{
+    auto value = std::make_shared<std::string>("returned value");
+    auto result = ResultWithReturnSharedPtr<BenchmarkErrorCodes, std::string>(value);
+    auto target = ResultWithReturnSharedPtr<BenchmarkErrorCodes, std::string>(value);
+
+    for (auto _ : state)
+    {
+        target = result;
+
+        benchmark::DoNotOptimize(target);
+    }
+}
+BENCHMARK(BM_ResultWithReturnSharedPtrAssign);
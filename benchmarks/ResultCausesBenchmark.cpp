@@ -0,0 +1,103 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "CPPResult.hpp"
+
+using SEFUtility::Result;
+using SEFUtility::ResultBase;
+
+using namespace SEFUtility::literals;
+
+enum class TaskErrorCodes
+{
+    SUCCESS = 0,
+    TASK_FAILED = 1000
+};
+
+enum class JobErrorCodes
+{
+    SUCCESS = 0,
+    JOB_FAILED = 1000
+};
+
+//
+//  Reporting the failures of N parallel tasks, the argument is N.  The Causes benchmarks hold the task
+//      failures as the causes of one failure, the Chain benchmarks wrap each task failure around the previous
+//      one.  Building includes creating the task failures, traversal counts the task failures in the tree.
+//
+
+static std::vector<Result<TaskErrorCodes>> make_tasks(int64_t count)
+{
+    std::vector<Result<TaskErrorCodes>> tasks;
+
+    tasks.reserve(count);
+
+    for (int64_t i = 0; i < count; i++)
+    {
+        tasks.push_back(Result<TaskErrorCodes>::failure(TaskErrorCodes::TASK_FAILED, "Task failed"_msg));
+    }
+
+    return (tasks);
+}
+
+static Result<JobErrorCodes> make_causes(const std::vector<Result<TaskErrorCodes>>& tasks)
+{
+    return (Result<JobErrorCodes>::failure(tasks, JobErrorCodes::JOB_FAILED, "Job failed"));
+}
+
+static Result<TaskErrorCodes> make_chain(const std::vector<Result<TaskErrorCodes>>& tasks)
+{
+    Result<TaskErrorCodes> chain = tasks.front();
+
+    for (std::size_t i = 1; i < tasks.size(); i++)
+    {
+        chain = Result<TaskErrorCodes>::failure(chain, TaskErrorCodes::TASK_FAILED, "Task failed"_msg);
+    }
+
+    return (chain);
+}
+
+static void BM_CausesBuild(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        auto job = make_causes(make_tasks(state.range(0)));
+
+        benchmark::DoNotOptimize(job);
+    }
+}
+BENCHMARK(BM_CausesBuild)->Arg(8)->Arg(50);
+
+static void BM_ChainBuild(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        auto job = make_chain(make_tasks(state.range(0)));
+
+        benchmark::DoNotOptimize(job);
+    }
+}
+BENCHMARK(BM_ChainBuild)->Arg(8)->Arg(50);
+
+static void BM_CausesTraverse(benchmark::State& state)
+{
+    auto job = make_causes(make_tasks(state.range(0)));
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(job.count_in_tree(TaskErrorCodes::TASK_FAILED));
+    }
+}
+BENCHMARK(BM_CausesTraverse)->Arg(8)->Arg(50);
+
+static void BM_ChainTraverse(benchmark::State& state)
+{
+    auto job = make_chain(make_tasks(state.range(0)));
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(job.count_in_tree(TaskErrorCodes::TASK_FAILED));
+    }
+}
+BENCHMARK(BM_ChainTraverse)->Arg(8)->Arg(50);
@@ -0,0 +1,107 @@
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+#include "CPPResultSerialization.hpp"
+
+using SEFUtility::Result;
+using SEFUtility::ResultBase;
+using SEFUtility::ResultWireFormat;
+using SEFUtility::SerializedResultView;
+
+using namespace SEFUtility::literals;
+
+enum class WireErrorCodes
+{
+    SUCCESS = 0,
+    CONNECTION_LOST = 1000,
+    QUERY_FAILED,
+    REQUEST_FAILED
+};
+
+//
+//  Writing a three level failure chain to a reused buffer, first by walking the chain and formatting each node
+//      as text and then as a binary record, and reading the binary record back through a view.
+//
+
+static Result<WireErrorCodes> wire_chain()
+{
+    auto root_cause = Result<WireErrorCodes>::failure(WireErrorCodes::CONNECTION_LOST, "Connection to {} lost", 7);
+    auto middle = Result<WireErrorCodes>::failure(root_cause, WireErrorCodes::QUERY_FAILED, "Query failed"_msg);
+
+    return (Result<WireErrorCodes>::failure(middle, WireErrorCodes::REQUEST_FAILED, "Request {} failed", 42));
+}
+
+static void BM_ChainFormatText(benchmark::State& state)
+{
+    auto result = wire_chain();
+    fmt::memory_buffer buffer;
+
+    for (auto _ : state)
+    {
+        buffer.clear();
+
+        for (const ResultBase* node = &result; node != nullptr; node = node->inner_error().get())
+        {
+            fmt::format_to(std::back_inserter(buffer), "{}:{}:{}\n", node->error_code_enum_name(),
+                           node->error_code_value(), node->message());
+        }
+
+        benchmark::DoNotOptimize(buffer.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * buffer.size());
+}
+BENCHMARK(BM_ChainFormatText);
+
+static void BM_ChainSerialize(benchmark::State& state)
+{
+    auto result = wire_chain();
+    std::vector<std::byte> buffer;
+
+    for (auto _ : state)
+    {
+        buffer.clear();
+
+        ResultWireFormat::serialize(result, buffer);
+
+        benchmark::DoNotOptimize(buffer.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * buffer.size());
+}
+BENCHMARK(BM_ChainSerialize);
+
+static void BM_ChainParseView(benchmark::State& state)
+{
+    std::vector<std::byte> buffer;
+
+    ResultWireFormat::serialize(wire_chain(), buffer);
+
+    for (auto _ : state)
+    {
+        auto view = SerializedResultView::parse(buffer);
+
+        benchmark::DoNotOptimize(view.return_value().contains_code(WireErrorCodes::CONNECTION_LOST));
+    }
+
+    state.SetBytesProcessed(state.iterations() * buffer.size());
+}
+BENCHMARK(BM_ChainParseView);
+
+static void BM_ChainMaterialize(benchmark::State& state)
+{
+    std::vector<std::byte> buffer;
+
+    ResultWireFormat::serialize(wire_chain(), buffer);
+
+    auto view = SerializedResultView::parse(buffer);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(view.return_value().materialize<WireErrorCodes>());
+    }
+}
+BENCHMARK(BM_ChainMaterialize);
@@ -0,0 +1,97 @@
+#include <benchmark/benchmark.h>
+
+#include <memory_resource>
+#include <string>
+
+#include "CPPResult.hpp"
+
+using SEFUtility::Result;
+using SEFUtility::ScopedResultMemoryResource;
+using SEFUtility::StaticMessage;
+
+using namespace SEFUtility::literals;
+
+enum class LookupErrorCodes
+{
+    SUCCESS = 0,
+    KEY_NOT_FOUND = 1000
+};
+
+//
+//  Memory resource forwarding to the default result resource which counts the allocations made by
+//      Results, reported per iteration so the literal message paths can be seen to never allocate.
+//
+
+class CountingResource : public std::pmr::memory_resource
+{
+   public:
+    size_t allocations() const { return (allocations_); }
+
+   private:
+    void* do_allocate(size_t bytes, size_t alignment) override
+    {
+        allocations_++;
+
+        return (upstream_->allocate(bytes, alignment));
+    }
+
+    void do_deallocate(void* block, size_t bytes, size_t alignment) override
+    {
+        upstream_->deallocate(block, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return (this == &other); }
+
+    std::pmr::memory_resource* upstream_ = SEFUtility::result_memory_resource();
+    size_t allocations_ = 0;
+};
+
+template <typename TFactory>
+static void MeasureResults(benchmark::State& state, TFactory factory)
+{
+    CountingResource resource;
+    ScopedResultMemoryResource scoped_resource(&resource);
+
+    for (auto _ : state)
+    {
+        auto result = factory();
+
+        benchmark::DoNotOptimize(result.message().data());
+    }
+
+    state.counters["allocations"] = benchmark::Counter(resource.allocations(), benchmark::Counter::kAvgIterations);
+}
+
+static void BM_CopiedLiteralFailure(benchmark::State& state)
+{
+    MeasureResults(state, []() {
+        return (Result<LookupErrorCodes>::failure(LookupErrorCodes::KEY_NOT_FOUND,
+                                                  "The requested key was not found in the configuration store"));
+    });
+}
+BENCHMARK(BM_CopiedLiteralFailure);
+
+static void BM_StaticLiteralFailure(benchmark::State& state)
+{
+    MeasureResults(state, []() {
+        return (Result<LookupErrorCodes>::failure(LookupErrorCodes::KEY_NOT_FOUND,
+                                                  "The requested key was not found in the configuration store"_msg));
+    });
+}
+BENCHMARK(BM_StaticLiteralFailure);
+
+static void BM_InternedFailure(benchmark::State& state)
+{
+    std::string message = "The requested key was not found in the configuration store";
+
+    MeasureResults(state, [&message]() {
+        return (Result<LookupErrorCodes>::failure(LookupErrorCodes::KEY_NOT_FOUND, StaticMessage::intern(message)));
+    });
+}
+BENCHMARK(BM_InternedFailure);
+
+static void BM_StaticSuccess(benchmark::State& state)
+{
+    MeasureResults(state, []() { return (Result<LookupErrorCodes>::success()); });
+}
+BENCHMARK(BM_StaticSuccess);
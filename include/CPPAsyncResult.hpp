@@ -0,0 +1,380 @@
+#pragma once
+
+#include <assert.h>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "CPPResult.hpp"
+
+//
+//  One-shot channel carrying a ResultWithReturnValue<TErrorCodeEnum, TResultType> from a producer, typically a
+//      task running on a thread pool, to a consumer.  The producer and consumer share a single reference
+//      counted state allocated from the result memory resource, completion is signalled through an atomic
+//      flag word so neither side takes a lock, and a consumer may either block in get() or register a
+//      continuation which runs inline on whichever thread completes the exchange.
+//
+
+namespace SEFUtility
+{
+    //
+    //  A promise destroyed without setting its result, for example because its task threw or was dropped by a
+    //      pool, publishes a failure so the consumer is never left waiting.  The failure's code is
+    //      TErrorCodeEnum::BROKEN_PROMISE if the enum declares one and otherwise the value -1, and its inner
+    //      error is always PromiseErrorCodes::BROKEN_PROMISE, so contains_code() finds it for any enum.
+    //
+
+    enum class PromiseErrorCodes
+    {
+        SUCCESS = 0,
+        BROKEN_PROMISE
+    };
+
+    template <>
+    struct ErrorCodeTraits<PromiseErrorCodes>
+    {
+        static constexpr ErrorCodeDescription codes[] = {CPPRESULT_ERROR_CODE(PromiseErrorCodes::BROKEN_PROMISE)};
+    };
+
+    template <typename TErrorCodeEnum>
+    constexpr TErrorCodeEnum broken_promise_code()
+    {
+        if constexpr (requires { TErrorCodeEnum::BROKEN_PROMISE; })
+        {
+            return (TErrorCodeEnum::BROKEN_PROMISE);
+        }
+        else
+        {
+            return (static_cast<TErrorCodeEnum>(-1));
+        }
+    }
+
+    template <typename TErrorCodeEnum, typename TResultType>
+    class AsyncResultPromise;
+
+    template <typename TErrorCodeEnum, typename TResultType>
+    class AsyncResultState
+    {
+       public:
+        typedef ResultWithReturnValue<TErrorCodeEnum, TResultType> ResultType;
+
+        static constexpr unsigned int RESULT_SET = 1;
+        static constexpr unsigned int CONTINUATION_SET = 2;
+
+        //  Continuations up to this size are stored in the state itself, larger ones cost an extra allocation.
+
+        static constexpr std::size_t INLINE_CONTINUATION_SIZE = 48;
+
+        AsyncResultState() = default;
+
+        AsyncResultState(const AsyncResultState&) = delete;
+        AsyncResultState& operator=(const AsyncResultState&) = delete;
+
+        ~AsyncResultState()
+        {
+            if (destroy_continuation_ != nullptr)
+            {
+                destroy_continuation_(continuation_);
+            }
+        }
+
+        static void* operator new(std::size_t size) { return (allocate_result_block(size)); }
+
+        static void operator delete(void* state, std::size_t size) { deallocate_result_block(state, size); }
+
+        //  The state starts with one reference for the promise and one for the AsyncResult.
+
+        void release_reference()
+        {
+            if (reference_count_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                delete this;
+            }
+        }
+
+        bool ready() const { return ((flags_.load(std::memory_order_acquire) & RESULT_SET) != 0); }
+
+        void set_result(ResultType&& result)
+        {
+            result_.emplace(std::move(result));
+
+            unsigned int previous_flags = flags_.fetch_or(RESULT_SET, std::memory_order_acq_rel);
+
+            assert((previous_flags & RESULT_SET) == 0);
+
+            if (previous_flags & CONTINUATION_SET)
+            {
+                run_continuation();
+            }
+            else
+            {
+                flags_.notify_all();
+            }
+        }
+
+        ResultType take_result()
+        {
+            unsigned int flags = flags_.load(std::memory_order_acquire);
+
+            assert((flags & CONTINUATION_SET) == 0);
+
+            while ((flags & RESULT_SET) == 0)
+            {
+                flags_.wait(flags, std::memory_order_acquire);
+                flags = flags_.load(std::memory_order_acquire);
+            }
+
+            return (std::move(*result_));
+        }
+
+        template <typename TContinuation>
+        void set_continuation(TContinuation&& continuation)
+        {
+            typedef std::decay_t<TContinuation> ContinuationType;
+
+            if constexpr ((sizeof(ContinuationType) <= INLINE_CONTINUATION_SIZE) &&
+                          (alignof(ContinuationType) <= alignof(std::max_align_t)))
+            {
+                new (continuation_) ContinuationType(std::forward<TContinuation>(continuation));
+
+                invoke_continuation_ = [](void* storage, ResultType&& result) {
+                    (*static_cast<ContinuationType*>(storage))(std::move(result));
+                };
+                destroy_continuation_ = [](void* storage) {
+                    static_cast<ContinuationType*>(storage)->~ContinuationType();
+                };
+            }
+            else
+            {
+                new (continuation_) ContinuationType*(new ContinuationType(std::forward<TContinuation>(continuation)));
+
+                invoke_continuation_ = [](void* storage, ResultType&& result) {
+                    (**static_cast<ContinuationType**>(storage))(std::move(result));
+                };
+                destroy_continuation_ = [](void* storage) { delete *static_cast<ContinuationType**>(storage); };
+            }
+
+            unsigned int previous_flags = flags_.fetch_or(CONTINUATION_SET, std::memory_order_acq_rel);
+
+            assert((previous_flags & CONTINUATION_SET) == 0);
+
+            if (previous_flags & RESULT_SET)
+            {
+                run_continuation();
+            }
+        }
+
+       private:
+        //  The continuation is destroyed even if it throws, so a promise it captured is released and reports a
+        //      broken promise rather than leaving its own consumer waiting.
+
+        void run_continuation()
+        {
+            struct ContinuationDestroyer
+            {
+                ~ContinuationDestroyer()
+                {
+                    state->destroy_continuation_(state->continuation_);
+                    state->destroy_continuation_ = nullptr;
+                }
+
+                AsyncResultState* state;
+            };
+
+            ContinuationDestroyer destroyer{this};
+
+            invoke_continuation_(continuation_, std::move(*result_));
+        }
+
+        std::atomic<unsigned int> reference_count_{2};
+
+        std::atomic<unsigned int> flags_{0};
+
+        std::optional<ResultType> result_;
+
+        void (*invoke_continuation_)(void* storage, ResultType&& result) = nullptr;
+        void (*destroy_continuation_)(void* storage) = nullptr;
+
+        alignas(std::max_align_t) unsigned char continuation_[INLINE_CONTINUATION_SIZE];
+    };
+
+    //
+    //  Consumer side of the channel.  Exactly one of get() or a continuation may consume the result.
+    //
+
+    template <typename TErrorCodeEnum, typename TResultType>
+    class AsyncResult
+    {
+       public:
+        typedef ResultWithReturnValue<TErrorCodeEnum, TResultType> ResultType;
+
+        AsyncResult(const AsyncResult&) = delete;
+        AsyncResult& operator=(const AsyncResult&) = delete;
+
+        AsyncResult(AsyncResult&& result_to_move) noexcept : state_(std::exchange(result_to_move.state_, nullptr)) {}
+
+        AsyncResult& operator=(AsyncResult&& result_to_move) noexcept
+        {
+            if (this != &result_to_move)
+            {
+                release();
+                state_ = std::exchange(result_to_move.state_, nullptr);
+            }
+
+            return (*this);
+        }
+
+        ~AsyncResult() { release(); }
+
+        bool valid() const { return (state_ != nullptr); }
+
+        bool ready() const
+        {
+            assert(state_);
+            return (state_->ready());
+        }
+
+        //  Blocks until the producer has set the result.
+
+        ResultType get()
+        {
+            assert(state_);
+
+            ResultType result = state_->take_result();
+
+            release();
+
+            return (result);
+        }
+
+        //  Registers a continuation receiving the ResultWithReturnValue as an rvalue.  It runs inline, either here
+        //      if the result is already set or on the producer's thread when it sets the result.
+
+        template <typename TContinuation>
+        void then(TContinuation&& continuation)
+        {
+            assert(state_);
+
+            AsyncResultState<TErrorCodeEnum, TResultType>* state = std::exchange(state_, nullptr);
+
+            state->set_continuation(std::forward<TContinuation>(continuation));
+            state->release_reference();
+        }
+
+        //  Continues a successful result with a function taking the return value and returning another
+        //      ResultWithReturnValue with the same error code type, a failure propagates without calling it.
+
+        template <typename TFunction>
+        auto and_then(TFunction&& function)
+        {
+            typedef std::remove_cvref_t<std::invoke_result_t<TFunction, TResultType&&>> ContinuationResult;
+            typedef decltype(std::declval<ContinuationResult>().return_value()) ContinuationValueRef;
+            typedef std::remove_reference_t<ContinuationValueRef> ContinuationValue;
+
+            static_assert(std::is_same_v<ContinuationResult, ResultWithReturnValue<TErrorCodeEnum, ContinuationValue>>,
+                          "AsyncResult::and_then() continuations must return a ResultWithReturnValue with the same "
+                          "error code type");
+
+            AsyncResultPromise<TErrorCodeEnum, ContinuationValue> promise;
+            AsyncResult<TErrorCodeEnum, ContinuationValue> continued_result = promise.get_async_result();
+
+            then([promise = std::move(promise), function = std::forward<TFunction>(function)](
+                     ResultType&& result) mutable {
+                promise.set_result(std::move(result).and_then(std::move(function)));
+            });
+
+            return (continued_result);
+        }
+
+       private:
+        friend class AsyncResultPromise<TErrorCodeEnum, TResultType>;
+
+        explicit AsyncResult(AsyncResultState<TErrorCodeEnum, TResultType>* state) : state_(state) {}
+
+        void release()
+        {
+            if (state_ != nullptr)
+            {
+                std::exchange(state_, nullptr)->release_reference();
+            }
+        }
+
+        AsyncResultState<TErrorCodeEnum, TResultType>* state_;
+    };
+
+    //
+    //  Producer side of the channel.  The result may be set at most once, a promise destroyed without setting it
+    //      sets a broken promise failure instead.
+    //
+
+    template <typename TErrorCodeEnum, typename TResultType>
+    class AsyncResultPromise
+    {
+       public:
+        typedef ResultWithReturnValue<TErrorCodeEnum, TResultType> ResultType;
+
+        AsyncResultPromise() : state_(new AsyncResultState<TErrorCodeEnum, TResultType>()) {}
+
+        AsyncResultPromise(const AsyncResultPromise&) = delete;
+        AsyncResultPromise& operator=(const AsyncResultPromise&) = delete;
+
+        AsyncResultPromise(AsyncResultPromise&& promise_to_move) noexcept
+            : state_(std::exchange(promise_to_move.state_, nullptr)),
+              result_retrieved_(promise_to_move.result_retrieved_),
+              result_set_(promise_to_move.result_set_)
+        {
+        }
+
+        AsyncResultPromise& operator=(AsyncResultPromise&& promise_to_move) = delete;
+
+        ~AsyncResultPromise()
+        {
+            if (state_ != nullptr)
+            {
+                if (!result_set_ && result_retrieved_)
+                {
+                    state_->set_result(ResultType(Result<TErrorCodeEnum>::failure(
+                        Result<PromiseErrorCodes>::failure(PromiseErrorCodes::BROKEN_PROMISE,
+                                                           StaticMessage("Promise destroyed without a result")),
+                        broken_promise_code<TErrorCodeEnum>(), StaticMessage("Broken promise"))));
+                }
+
+                if (!result_retrieved_)
+                {
+                    state_->release_reference();
+                }
+
+                state_->release_reference();
+            }
+        }
+
+        AsyncResult<TErrorCodeEnum, TResultType> get_async_result()
+        {
+            assert(!result_retrieved_);
+
+            result_retrieved_ = true;
+
+            return (AsyncResult<TErrorCodeEnum, TResultType>(state_));
+        }
+
+        void set_result(ResultType&& result)
+        {
+            assert(!result_set_);
+
+            result_set_ = true;
+            state_->set_result(std::move(result));
+        }
+
+        void set_result(const ResultType& result) { set_result(ResultType(result)); }
+
+       private:
+        AsyncResultState<TErrorCodeEnum, TResultType>* state_;
+
+        bool result_retrieved_ = false;
+        bool result_set_ = false;
+    };
+}  // namespace SEFUtility
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <assert.h>
+#include <string_view>
+#include <type_traits>
+
+#include "CPPErrorCodeTraits.hpp"
+
+//
+//  Result for the tightest loops, which only ever branch on the error code.  The error code is the whole
+//      object, a failure is any code other than SUCCESS, so the type is the size of the enum and is trivially
+//      copyable.  The factories accept the same arguments as those of Result<TErrorCodeEnum> so call sites
+//      compile unchanged when the type is switched, but messages, format arguments and inner errors are
+//      discarded without being formatted.  This header does not depend on fmt or CPPResult.hpp.
+//
+
+namespace SEFUtility
+{
+    class ResultBase;
+
+    template <typename TErrorCodeEnum>
+    class CodeOnlyResult
+    {
+       public:
+        typedef TErrorCodeEnum ErrorCodeType;
+
+        constexpr CodeOnlyResult() : error_code_(TErrorCodeEnum::SUCCESS) {}
+
+        static constexpr CodeOnlyResult<TErrorCodeEnum> success() { return (CodeOnlyResult()); }
+
+        template <typename TMessage, typename... Args>
+        static constexpr CodeOnlyResult<TErrorCodeEnum> failure(TErrorCodeEnum error_code, const TMessage&,
+                                                                const Args&...)
+        {
+            return (CodeOnlyResult(error_code));
+        }
+
+        template <typename TInnerError, typename TMessage, typename... Args>
+            requires(!std::is_same_v<TInnerError, TErrorCodeEnum>)
+        static constexpr CodeOnlyResult<TErrorCodeEnum> failure(const TInnerError&, TErrorCodeEnum error_code,
+                                                                const TMessage&, const Args&...)
+        {
+            return (CodeOnlyResult(error_code));
+        }
+
+        template <typename TMessage, typename... Args>
+        static constexpr CodeOnlyResult<TErrorCodeEnum> lazy_failure(TErrorCodeEnum error_code, const TMessage&,
+                                                                     const Args&...)
+        {
+            return (CodeOnlyResult(error_code));
+        }
+
+        template <typename TInnerError, typename TMessage, typename... Args>
+            requires(!std::is_same_v<TInnerError, TErrorCodeEnum>)
+        static constexpr CodeOnlyResult<TErrorCodeEnum> lazy_failure(const TInnerError&, TErrorCodeEnum error_code,
+                                                                     const TMessage&, const Args&...)
+        {
+            return (CodeOnlyResult(error_code));
+        }
+
+        constexpr bool succeeded() const { return (error_code_ == TErrorCodeEnum::SUCCESS); }
+
+        constexpr bool failed() const { return (error_code_ != TErrorCodeEnum::SUCCESS); }
+
+        constexpr TErrorCodeEnum error_code() const { return (error_code_); }
+
+        constexpr int error_code_value() const { return (static_cast<int>(error_code_)); }
+
+        constexpr ErrorDomainId error_domain() const { return (ErrorCodeMetadata<TErrorCodeEnum>::domain_id()); }
+
+        constexpr std::string_view error_code_name() const
+        {
+            return (ErrorCodeMetadata<TErrorCodeEnum>::name(error_code_));
+        }
+
+        constexpr bool retryable() const
+        {
+            return (failed() && ErrorCodeMetadata<TErrorCodeEnum>::retryable(error_code_));
+        }
+
+        //  Messages and inner errors are never stored, every failure has an empty message.
+
+        constexpr std::string_view message() const { return (succeeded() ? "Success" : std::string_view()); }
+
+        constexpr const ResultBase* inner_error() const { return (nullptr); }
+
+       private:
+        explicit constexpr CodeOnlyResult(TErrorCodeEnum error_code) : error_code_(error_code)
+        {
+            assert(error_code != TErrorCodeEnum::SUCCESS);
+        }
+
+        TErrorCodeEnum error_code_;
+    };
+}  // namespace SEFUtility
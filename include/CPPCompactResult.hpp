@@ -0,0 +1,558 @@
+#pragma once
+
+#include <assert.h>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "CPPResult.hpp"
+
+//
+//  Clang can pass and return types marked trivial_abi in registers even though they have a non-trivial
+//      destructor, other compilers ignore the attribute.
+//
+
+#if defined(__clang__)
+#define CPPRESULT_TRIVIAL_ABI [[clang::trivial_abi]]
+#else
+#define CPPRESULT_TRIVIAL_ABI
+#endif
+
+namespace SEFUtility
+{
+    //
+    //  Non-virtual alternative to Result<TErrorCodeEnum> for hot paths.  A success is the error code
+    //      alone, the message and inner error of a failure live behind a single pointer which is null on
+    //      success, so the success path never allocates and never runs a virtual destructor.  The details of a
+    //      failure and its message come from the result memory resource, see allocate_result_block(), and are
+    //      immutable and reference counted, so copying a failure shares them.
+    //
+
+    template <typename TErrorCodeEnum>
+    class CPPRESULT_TRIVIAL_ABI CompactResult
+    {
+       private:
+        struct FailureDetails
+        {
+            explicit FailureDetails(std::string_view message) : message_(message, result_memory_resource()) {}
+
+            FailureDetails(const ResultBase& inner_error, std::string_view message)
+                : message_(message, result_memory_resource()), inner_error_(inner_error.as_inner_error())
+            {
+            }
+
+            explicit FailureDetails(const ResultBase& failure)
+                : message_(failure.message(), result_memory_resource()), inner_error_(failure.inner_error())
+            {
+            }
+
+            FailureDetails(const FailureDetails&) = delete;
+            FailureDetails& operator=(const FailureDetails&) = delete;
+
+            static void* operator new(std::size_t size) { return (allocate_result_block(size)); }
+
+            static void operator delete(void* details, std::size_t size) { deallocate_result_block(details, size); }
+
+            static FailureDetails* add_reference(FailureDetails* details)
+            {
+                if (details != nullptr)
+                {
+#if defined(CPPRESULT_NON_ATOMIC_REFCOUNT)
+                    details->reference_count_++;
+#else
+                    details->reference_count_.fetch_add(1, std::memory_order_relaxed);
+#endif
+                }
+
+                return (details);
+            }
+
+            static void release_reference(FailureDetails* details)
+            {
+                if (details == nullptr)
+                {
+                    return;
+                }
+
+#if defined(CPPRESULT_NON_ATOMIC_REFCOUNT)
+                if (--details->reference_count_ == 0)
+#else
+                if (details->reference_count_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+#endif
+                {
+                    delete details;
+                }
+            }
+
+            ResultReferenceCount reference_count_{1};
+
+            std::pmr::string message_;
+
+            InnerErrorPtr inner_error_;
+        };
+
+        constexpr CompactResult(TErrorCodeEnum error_code, FailureDetails* details)
+            : error_code_(error_code), details_(details)
+        {
+            assert((error_code == TErrorCodeEnum::SUCCESS) == (details == nullptr));
+        }
+
+       public:
+        typedef TErrorCodeEnum ErrorCodeType;
+
+        CompactResult(const CompactResult<TErrorCodeEnum>& result_to_copy)
+            : error_code_(result_to_copy.error_code_), details_(FailureDetails::add_reference(result_to_copy.details_))
+        {
+        }
+
+        constexpr CompactResult(CompactResult<TErrorCodeEnum>&& result_to_move) noexcept
+            : error_code_(result_to_move.error_code_), details_(std::exchange(result_to_move.details_, nullptr))
+        {
+        }
+
+        //  Converting from a Result<TErrorCodeEnum> preserves the message and inner error of a failure.
+
+        explicit CompactResult(const Result<TErrorCodeEnum>& result)
+            : error_code_(result.succeeded() ? TErrorCodeEnum::SUCCESS : result.error_code()),
+              details_(result.succeeded() ? nullptr : new FailureDetails(result))
+        {
+        }
+
+        //  Constant evaluation only ever destroys successes, which hold no details.
+
+        constexpr ~CompactResult()
+        {
+            if (details_ != nullptr)
+            {
+                FailureDetails::release_reference(details_);
+            }
+        }
+
+        const CompactResult<TErrorCodeEnum>& operator=(const CompactResult<TErrorCodeEnum>& result_to_copy)
+        {
+            //  The new reference is taken first so self assignment never releases the last one.
+
+            FailureDetails* details = FailureDetails::add_reference(result_to_copy.details_);
+
+            FailureDetails::release_reference(details_);
+
+            error_code_ = result_to_copy.error_code_;
+            details_ = details;
+
+            return (*this);
+        }
+
+        const CompactResult<TErrorCodeEnum>& operator=(CompactResult<TErrorCodeEnum>&& result_to_move) noexcept
+        {
+            if (this != &result_to_move)
+            {
+                FailureDetails::release_reference(details_);
+
+                error_code_ = result_to_move.error_code_;
+                details_ = std::exchange(result_to_move.details_, nullptr);
+            }
+
+            return (*this);
+        }
+
+        static constexpr CompactResult<TErrorCodeEnum> success()
+        {
+            return (CompactResult(TErrorCodeEnum::SUCCESS, nullptr));
+        }
+
+        static CompactResult<TErrorCodeEnum> failure(TErrorCodeEnum error_code, std::string_view message)
+        {
+            return (CompactResult(error_code, new FailureDetails(message)));
+        }
+
+        template <typename... Args>
+        static CompactResult<TErrorCodeEnum> failure(TErrorCodeEnum error_code, std::string_view format, Args... args)
+        {
+            return (CompactResult(error_code, new FailureDetails(FormattedMessage(format, args...))));
+        }
+
+        template <typename TInnerErrorCodeEnum>
+        static CompactResult<TErrorCodeEnum> failure(const Result<TInnerErrorCodeEnum>& inner_error,
+                                                     TErrorCodeEnum error_code, std::string_view message)
+        {
+            return (CompactResult(error_code, new FailureDetails(inner_error, message)));
+        }
+
+        template <typename TInnerErrorCodeEnum, typename... Args>
+        static CompactResult<TErrorCodeEnum> failure(const Result<TInnerErrorCodeEnum>& inner_error,
+                                                     TErrorCodeEnum error_code, std::string_view format,
+                                                     Args... args)
+        {
+            return (CompactResult(error_code, new FailureDetails(inner_error, FormattedMessage(format, args...))));
+        }
+
+        template <typename TInnerErrorCodeEnum>
+        static CompactResult<TErrorCodeEnum> failure(const CompactResult<TInnerErrorCodeEnum>& inner_error,
+                                                     TErrorCodeEnum error_code, std::string_view message)
+        {
+            return (failure(inner_error.to_result(), error_code, message));
+        }
+
+        template <typename TInnerErrorCodeEnum, typename... Args>
+        static CompactResult<TErrorCodeEnum> failure(const CompactResult<TInnerErrorCodeEnum>& inner_error,
+                                                     TErrorCodeEnum error_code, std::string_view format,
+                                                     Args... args)
+        {
+            return (failure(inner_error.to_result(), error_code, FormattedMessage(format, args...)));
+        }
+
+        constexpr bool succeeded() const { return (error_code_ == TErrorCodeEnum::SUCCESS); }
+
+        constexpr bool failed() const { return (error_code_ != TErrorCodeEnum::SUCCESS); }
+
+        constexpr TErrorCodeEnum error_code() const { return (error_code_); }
+
+        constexpr int error_code_value() const { return ((int)error_code_); }
+
+        constexpr std::string_view error_code_name() const
+        {
+            return (ErrorCodeMetadata<TErrorCodeEnum>::name(error_code_));
+        }
+
+        constexpr bool retryable() const
+        {
+            return (failed() && ErrorCodeMetadata<TErrorCodeEnum>::retryable(error_code_));
+        }
+
+        std::string_view message() const
+        {
+            if (succeeded())
+            {
+                return ("Success");
+            }
+
+            return (details_ ? std::string_view(details_->message_) : std::string_view());
+        }
+
+        const ResultBase* inner_error() const { return (details_ ? details_->inner_error_.get() : nullptr); }
+
+        Result<TErrorCodeEnum> to_result() const
+        {
+            if (succeeded())
+            {
+                return (Result<TErrorCodeEnum>::success());
+            }
+
+            //  A moved-from failure no longer holds its message or inner error, only its code.
+
+            if (details_ == nullptr)
+            {
+                return (Result<TErrorCodeEnum>::failure(error_code_, ""));
+            }
+
+            return (details_->inner_error_ ? Result<TErrorCodeEnum>::failure(*details_->inner_error_, error_code_,
+                                                                              details_->message_)
+                                           : Result<TErrorCodeEnum>::failure(error_code_, details_->message_));
+        }
+
+       private:
+        TErrorCodeEnum error_code_;
+
+        FailureDetails* details_;
+    };
+
+    //
+    //  Non-virtual alternative to ResultWithReturnValue for hot paths.  The return value and the failure share
+    //      storage with the error code as the tag between them, so a success is the return value plus one word
+    //      and is copied, moved and destroyed as the return value alone.  A failure is a single pointer to a
+    //      reference counted Result<TErrorCodeEnum> chain node, copying it shares the node.
+    //
+
+    template <typename TErrorCodeEnum, typename TResultType>
+    class CPPRESULT_TRIVIAL_ABI CompactResultWithReturnValue
+    {
+       private:
+        //  Takes ownership of the failure as a chain node, the node is shared by copies of this result and by
+        //      any Result which takes this one as its inner error.
+
+        static const ResultBase* make_failure_node(Result<TErrorCodeEnum>&& failure)
+        {
+            assert(failure.failed());
+
+            Result<TErrorCodeEnum>* node = new Result<TErrorCodeEnum>(std::move(failure));
+
+            node->message();
+
+            return (InnerErrorPtr(node).release());
+        }
+
+        //  Destroys whichever member is active, the object must be reconstructed before it is used again.
+
+        void destroy() noexcept
+        {
+            if (succeeded())
+            {
+                std::destroy_at(&return_value_);
+            }
+            else
+            {
+                InnerErrorPtr::adopt(failure_);
+            }
+        }
+
+       public:
+        typedef TErrorCodeEnum ErrorCodeType;
+        typedef TResultType ResultType;
+
+        CompactResultWithReturnValue(const TResultType& return_value)
+            : error_code_(TErrorCodeEnum::SUCCESS), return_value_(return_value)
+        {
+        }
+
+        CompactResultWithReturnValue(TResultType&& return_value)
+            : error_code_(TErrorCodeEnum::SUCCESS), return_value_(std::move(return_value))
+        {
+        }
+
+        template <typename... Args>
+        explicit CompactResultWithReturnValue(std::in_place_t, Args&&... args)
+            : error_code_(TErrorCodeEnum::SUCCESS), return_value_(std::forward<Args>(args)...)
+        {
+        }
+
+        //  Propagates a failure with the same error code type, taking over its message and inner error chain.
+
+        explicit CompactResultWithReturnValue(Result<TErrorCodeEnum>&& failure)
+            : error_code_(failure.error_code()), failure_(make_failure_node(std::move(failure)))
+        {
+        }
+
+        //  Converting from a ResultWithReturnValue preserves the message and inner error of a failure.
+
+        explicit CompactResultWithReturnValue(const ResultWithReturnValue<TErrorCodeEnum, TResultType>& result)
+            : error_code_(result.error_code())
+        {
+            if (result.succeeded())
+            {
+                std::construct_at(&return_value_, result.return_value());
+            }
+            else
+            {
+                failure_ = result.as_inner_error().release();
+            }
+        }
+
+        CompactResultWithReturnValue(const CompactResultWithReturnValue& result_to_copy)
+            : error_code_(result_to_copy.error_code_)
+        {
+            if (succeeded())
+            {
+                std::construct_at(&return_value_, result_to_copy.return_value_);
+            }
+            else
+            {
+                failure_ = InnerErrorPtr(result_to_copy.failure_).release();
+            }
+        }
+
+        //  A moved-from failure keeps its error code but no longer holds its message or inner error.
+
+        CompactResultWithReturnValue(CompactResultWithReturnValue&& result_to_move) noexcept(
+            std::is_nothrow_move_constructible_v<TResultType>)
+            : error_code_(result_to_move.error_code_)
+        {
+            if (succeeded())
+            {
+                std::construct_at(&return_value_, std::move(result_to_move.return_value_));
+            }
+            else
+            {
+                failure_ = std::exchange(result_to_move.failure_, nullptr);
+            }
+        }
+
+        ~CompactResultWithReturnValue() { destroy(); }
+
+        //  Assigning a success over a success assigns the values.  Otherwise the member being replaced is only
+        //      released once its replacement has been built, so a value whose construction throws leaves this
+        //      result as it was.
+
+        const CompactResultWithReturnValue& operator=(const CompactResultWithReturnValue& result_to_copy)
+        {
+            if (this == &result_to_copy)
+            {
+                return (*this);
+            }
+
+            if (succeeded() && result_to_copy.succeeded())
+            {
+                return_value_ = result_to_copy.return_value_;
+
+                return (*this);
+            }
+
+            CompactResultWithReturnValue copy(result_to_copy);
+
+            return (*this = std::move(copy));
+        }
+
+        const CompactResultWithReturnValue& operator=(CompactResultWithReturnValue&& result_to_move) noexcept(
+            std::is_nothrow_move_constructible_v<TResultType> && std::is_nothrow_move_assignable_v<TResultType>)
+        {
+            if (this == &result_to_move)
+            {
+                return (*this);
+            }
+
+            if (result_to_move.failed())
+            {
+                const ResultBase* failure = std::exchange(result_to_move.failure_, nullptr);
+
+                destroy();
+                failure_ = failure;
+            }
+            else if (succeeded())
+            {
+                return_value_ = std::move(result_to_move.return_value_);
+            }
+            else
+            {
+                const ResultBase* previous_failure = failure_;
+
+                if constexpr (std::is_nothrow_move_constructible_v<TResultType>)
+                {
+                    std::construct_at(&return_value_, std::move(result_to_move.return_value_));
+                }
+                else
+                {
+                    try
+                    {
+                        std::construct_at(&return_value_, std::move(result_to_move.return_value_));
+                    }
+                    catch (...)
+                    {
+                        failure_ = previous_failure;
+                        throw;
+                    }
+                }
+
+                InnerErrorPtr::adopt(previous_failure);
+            }
+
+            error_code_ = result_to_move.error_code_;
+
+            return (*this);
+        }
+
+        static CompactResultWithReturnValue success(const TResultType& return_value)
+        {
+            return (CompactResultWithReturnValue(return_value));
+        }
+
+        static CompactResultWithReturnValue success(TResultType&& return_value)
+        {
+            return (CompactResultWithReturnValue(std::move(return_value)));
+        }
+
+        template <typename... Args>
+        static CompactResultWithReturnValue success(std::in_place_t, Args&&... args)
+        {
+            return (CompactResultWithReturnValue(std::in_place, std::forward<Args>(args)...));
+        }
+
+        static CompactResultWithReturnValue failure(TErrorCodeEnum error_code, LocatedMessage message)
+        {
+            return (CompactResultWithReturnValue(Result<TErrorCodeEnum>::failure(error_code, message)));
+        }
+
+        template <typename... Args>
+        static CompactResultWithReturnValue failure(TErrorCodeEnum error_code, LocatedMessage format, Args... args)
+        {
+            return (CompactResultWithReturnValue(Result<TErrorCodeEnum>::failure(error_code, format, args...)));
+        }
+
+        static CompactResultWithReturnValue failure(const ResultBase& inner_error, TErrorCodeEnum error_code,
+                                                    LocatedMessage message)
+        {
+            return (CompactResultWithReturnValue(Result<TErrorCodeEnum>::failure(inner_error, error_code, message)));
+        }
+
+        template <typename... Args>
+        static CompactResultWithReturnValue failure(const ResultBase& inner_error, TErrorCodeEnum error_code,
+                                                    LocatedMessage format, Args... args)
+        {
+            return (CompactResultWithReturnValue(
+                Result<TErrorCodeEnum>::failure(inner_error, error_code, format, args...)));
+        }
+
+        bool succeeded() const { return (error_code_ == TErrorCodeEnum::SUCCESS); }
+
+        bool failed() const { return (error_code_ != TErrorCodeEnum::SUCCESS); }
+
+        TErrorCodeEnum error_code() const { return (error_code_); }
+
+        int error_code_value() const { return ((int)error_code_); }
+
+        std::string_view error_code_name() const { return (ErrorCodeMetadata<TErrorCodeEnum>::name(error_code_)); }
+
+        bool retryable() const { return (failed() && ErrorCodeMetadata<TErrorCodeEnum>::retryable(error_code_)); }
+
+        std::string_view message() const
+        {
+            return (succeeded() ? std::string_view("Success")
+                                : (failure_ != nullptr ? failure_->message() : std::string_view()));
+        }
+
+        const ResultBase* inner_error() const
+        {
+            return ((failed() && (failure_ != nullptr)) ? failure_->inner_error().get() : nullptr);
+        }
+
+        TResultType& return_value() &
+        {
+            assert(succeeded());
+            return (return_value_);
+        }
+
+        const TResultType& return_value() const&
+        {
+            assert(succeeded());
+            return (return_value_);
+        }
+
+        TResultType&& return_value() &&
+        {
+            assert(succeeded());
+            return (std::move(return_value_));
+        }
+
+        ResultWithReturnValue<TErrorCodeEnum, TResultType> to_result() const
+        {
+            if (succeeded())
+            {
+                return (ResultWithReturnValue<TErrorCodeEnum, TResultType>::success(return_value_));
+            }
+
+            //  A moved-from failure no longer holds its message or inner error, only its code.
+
+            if (failure_ == nullptr)
+            {
+                return (ResultWithReturnValue<TErrorCodeEnum, TResultType>::failure(error_code_, ""));
+            }
+
+            return (ResultWithReturnValue<TErrorCodeEnum, TResultType>(
+                Result<TErrorCodeEnum>(static_cast<const Result<TErrorCodeEnum>&>(*failure_))));
+        }
+
+       private:
+        TErrorCodeEnum error_code_;
+
+        union
+        {
+            TResultType return_value_;
+
+            const ResultBase* failure_;
+        };
+    };
+}  // namespace SEFUtility
@@ -0,0 +1,180 @@
+#pragma once
+
+#include <algorithm>
+#include <assert.h>
+#include <cstddef>
+#include <span>
+#include <string_view>
+#include <type_traits>
+
+#include "CPPErrorCodeTraits.hpp"
+
+//
+//  Result usable in constant expressions, for validators which are evaluated at compile time and checked with
+//      static_assert, and which cost no more than the comparisons they make when called at runtime.  Messages
+//      must be string literals, which are referenced rather than copied, and the inner error chain is held
+//      inline as a fixed number of frames, so the type never allocates and is trivially copyable.  This
+//      header does not depend on fmt or CPPResult.hpp.
+//
+
+namespace SEFUtility
+{
+    //  Message of a ConstexprResult.  The constructor is consteval, so only string literals and other arrays
+    //      usable in constant expressions are accepted and a Result can never refer to a buffer on the stack.
+
+    class ConstexprMessage
+    {
+       public:
+        template <std::size_t N>
+        consteval ConstexprMessage(const char (&text)[N]) : text_(text, N - 1)
+        {
+        }
+
+        constexpr std::string_view view() const { return (text_); }
+
+       private:
+        std::string_view text_;
+    };
+
+    class ConstexprErrorFrame
+    {
+       public:
+        constexpr ConstexprErrorFrame() = default;
+
+        constexpr ConstexprErrorFrame(ErrorDomainId error_domain, int error_code_value, std::string_view message)
+            : error_domain_(error_domain), error_code_value_(error_code_value), message_(message)
+        {
+        }
+
+        constexpr ErrorDomainId error_domain() const { return (error_domain_); }
+
+        constexpr int error_code_value() const { return (error_code_value_); }
+
+        constexpr std::string_view message() const { return (message_); }
+
+        template <typename TErrorCodeEnum>
+        constexpr bool is_code(TErrorCodeEnum error_code) const
+        {
+            return ((error_domain_ == ErrorCodeMetadata<TErrorCodeEnum>::domain_id()) &&
+                    (error_code_value_ == static_cast<int>(error_code)));
+        }
+
+       private:
+        ErrorDomainId error_domain_ = 0;
+
+        int error_code_value_ = 0;
+
+        std::string_view message_;
+    };
+
+    template <typename TErrorCodeEnum>
+    class ConstexprResult
+    {
+       public:
+        typedef TErrorCodeEnum ErrorCodeType;
+
+        //  The frames kept for a failure, the failure itself included.  When a deeper chain is wrapped the frames
+        //      just inside the root cause are dropped and counted, the outermost frames and the root cause are
+        //      kept.
+
+        static constexpr std::size_t MAX_DEPTH = 4;
+
+        constexpr ConstexprResult() : ConstexprResult(TErrorCodeEnum::SUCCESS, "Success") {}
+
+        static constexpr ConstexprResult<TErrorCodeEnum> success() { return (ConstexprResult()); }
+
+        static constexpr ConstexprResult<TErrorCodeEnum> failure(TErrorCodeEnum error_code, ConstexprMessage message)
+        {
+            assert(error_code != TErrorCodeEnum::SUCCESS);
+
+            return (ConstexprResult(error_code, message.view()));
+        }
+
+        template <typename TInnerErrorCodeEnum>
+        static constexpr ConstexprResult<TErrorCodeEnum> failure(
+            const ConstexprResult<TInnerErrorCodeEnum>& inner_error, TErrorCodeEnum error_code,
+            ConstexprMessage message)
+        {
+            assert(error_code != TErrorCodeEnum::SUCCESS);
+            assert(inner_error.failed());
+
+            ConstexprResult result(error_code, message.view());
+
+            std::span<const ConstexprErrorFrame> inner_chain = inner_error.chain();
+
+            if (inner_chain.size() < MAX_DEPTH)
+            {
+                std::copy(inner_chain.begin(), inner_chain.end(), result.frames_ + 1);
+                result.depth_ += inner_chain.size();
+            }
+            else
+            {
+                std::copy(inner_chain.begin(), inner_chain.begin() + (MAX_DEPTH - 2), result.frames_ + 1);
+                result.frames_[MAX_DEPTH - 1] = inner_chain.back();
+                result.depth_ = MAX_DEPTH;
+                result.dropped_frames_ += inner_chain.size() - (MAX_DEPTH - 1);
+            }
+
+            result.dropped_frames_ += inner_error.dropped_frames();
+
+            return (result);
+        }
+
+        constexpr bool succeeded() const { return (error_code() == TErrorCodeEnum::SUCCESS); }
+
+        constexpr bool failed() const { return (error_code() != TErrorCodeEnum::SUCCESS); }
+
+        constexpr TErrorCodeEnum error_code() const
+        {
+            return (static_cast<TErrorCodeEnum>(frames_[0].error_code_value()));
+        }
+
+        constexpr int error_code_value() const { return (frames_[0].error_code_value()); }
+
+        constexpr ErrorDomainId error_domain() const { return (ErrorCodeMetadata<TErrorCodeEnum>::domain_id()); }
+
+        constexpr std::string_view error_code_name() const
+        {
+            return (ErrorCodeMetadata<TErrorCodeEnum>::name(error_code()));
+        }
+
+        constexpr bool retryable() const
+        {
+            return (failed() && ErrorCodeMetadata<TErrorCodeEnum>::retryable(error_code()));
+        }
+
+        constexpr std::string_view message() const { return (frames_[0].message()); }
+
+        constexpr const ConstexprErrorFrame* inner_error() const { return (depth_ > 1 ? &frames_[1] : nullptr); }
+
+        //  This result and the inner errors kept for it, outermost first.
+
+        constexpr std::span<const ConstexprErrorFrame> chain() const
+        {
+            return (std::span<const ConstexprErrorFrame>(frames_, depth_));
+        }
+
+        constexpr std::size_t dropped_frames() const { return (dropped_frames_); }
+
+        template <typename TSearchErrorCodeEnum>
+        constexpr bool contains_code(TSearchErrorCodeEnum error_code) const
+        {
+            return (std::any_of(frames_, frames_ + depth_, [error_code](const ConstexprErrorFrame& frame) {
+                return (frame.is_code(error_code));
+            }));
+        }
+
+       private:
+        constexpr ConstexprResult(TErrorCodeEnum error_code, std::string_view message)
+            : frames_{ConstexprErrorFrame(ErrorCodeMetadata<TErrorCodeEnum>::domain_id(),
+                                          static_cast<int>(error_code), message)}
+        {
+        }
+
+        ConstexprErrorFrame frames_[MAX_DEPTH];
+
+        std::size_t depth_ = 1;
+
+        std::size_t dropped_frames_ = 0;
+    };
+}  // namespace SEFUtility
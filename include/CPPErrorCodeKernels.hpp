@@ -0,0 +1,354 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+//
+//  Scanning kernels over packed arrays of 32 bit error codes, e.g. ResultBatch::error_codes().  Each kernel
+//      has a scalar implementation and, when built with GCC or Clang for x86, SSE2 and AVX2 implementations.
+//      The widest implementation supported by the processor is selected the first time a kernel is called.
+//
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define CPPRESULT_X86_KERNELS
+#include <immintrin.h>
+#endif
+
+namespace SEFUtility
+{
+    class ErrorCodeKernels
+    {
+       public:
+        //  Codes are read with unaligned loads, so codes may point at any array of 32 bit enumerators.
+
+        typedef std::size_t (*FindFunction)(const void* codes, std::size_t count, std::int32_t value);
+        typedef std::size_t (*CountFunction)(const void* codes, std::size_t count, std::int32_t value);
+        typedef void (*CollectFunction)(const void* codes, std::size_t count, std::int32_t value,
+                                        std::vector<std::size_t>& indices);
+
+        struct Implementation
+        {
+            const char* name_;
+
+            //  Index of the first code not equal to value, count if there is none.
+
+            FindFunction find_first_not_equal_;
+
+            CountFunction count_equal_;
+
+            //  Appends the index of every code equal to value.
+
+            CollectFunction collect_equal_;
+        };
+
+        static const Implementation& scalar()
+        {
+            static const Implementation implementation{"scalar", scalar_find_first_not_equal, scalar_count_equal,
+                                                       scalar_collect_equal};
+
+            return (implementation);
+        }
+
+        //  Null when the processor or compiler does not support the instruction set.
+
+        static const Implementation* sse2()
+        {
+#if defined(CPPRESULT_X86_KERNELS)
+            static const Implementation implementation{"sse2", sse2_find_first_not_equal, sse2_count_equal,
+                                                       sse2_collect_equal};
+
+            return (__builtin_cpu_supports("sse2") ? &implementation : nullptr);
+#else
+            return (nullptr);
+#endif
+        }
+
+        static const Implementation* avx2()
+        {
+#if defined(CPPRESULT_X86_KERNELS)
+            static const Implementation implementation{"avx2", avx2_find_first_not_equal, avx2_count_equal,
+                                                       avx2_collect_equal};
+
+            return (__builtin_cpu_supports("avx2") ? &implementation : nullptr);
+#else
+            return (nullptr);
+#endif
+        }
+
+        static const Implementation& best()
+        {
+            static const Implementation& implementation = avx2() ? *avx2() : (sse2() ? *sse2() : scalar());
+
+            return (implementation);
+        }
+
+        static bool any_not_equal(const void* codes, std::size_t count, std::int32_t value)
+        {
+            return (best().find_first_not_equal_(codes, count, value) != count);
+        }
+
+        static std::size_t find_first_not_equal(const void* codes, std::size_t count, std::int32_t value)
+        {
+            return (best().find_first_not_equal_(codes, count, value));
+        }
+
+        static std::size_t count_equal(const void* codes, std::size_t count, std::int32_t value)
+        {
+            return (best().count_equal_(codes, count, value));
+        }
+
+        static void collect_equal(const void* codes, std::size_t count, std::int32_t value,
+                                  std::vector<std::size_t>& indices)
+        {
+            best().collect_equal_(codes, count, value, indices);
+        }
+
+       private:
+        static std::int32_t load_code(const void* codes, std::size_t index)
+        {
+            std::int32_t code;
+
+            std::memcpy(&code, static_cast<const std::int32_t*>(codes) + index, sizeof(code));
+
+            return (code);
+        }
+
+        static std::size_t scalar_find_first_not_equal(const void* codes, std::size_t count, std::int32_t value)
+        {
+            std::size_t index = 0;
+
+            while ((index < count) && (load_code(codes, index) == value))
+            {
+                index++;
+            }
+
+            return (index);
+        }
+
+        static std::size_t scalar_count_equal(const void* codes, std::size_t count, std::int32_t value)
+        {
+            std::size_t matches = 0;
+
+            for (std::size_t index = 0; index < count; index++)
+            {
+                matches += (load_code(codes, index) == value) ? 1 : 0;
+            }
+
+            return (matches);
+        }
+
+        static void scalar_collect_equal(const void* codes, std::size_t count, std::int32_t value,
+                                         std::vector<std::size_t>& indices)
+        {
+            for (std::size_t index = 0; index < count; index++)
+            {
+                if (load_code(codes, index) == value)
+                {
+                    indices.push_back(index);
+                }
+            }
+        }
+
+#if defined(CPPRESULT_X86_KERNELS)
+
+        //  Per lane match counts are 32 bits wide and are folded into the total at least this often.
+
+        static constexpr std::size_t LANE_COUNT_LIMIT = std::size_t(1) << 24;
+
+        //  Each vector comparison yields one mask bit per code, the remainder is handled by the scalar kernels.
+
+        __attribute__((target("sse2"))) static unsigned int sse2_equal_mask(const void* codes, std::size_t index,
+                                                                            __m128i value)
+        {
+            __m128i block =
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(static_cast<const std::int32_t*>(codes) + index));
+
+            return (static_cast<unsigned int>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(block, value)))));
+        }
+
+        __attribute__((target("sse2"))) static std::size_t sse2_find_first_not_equal(const void* codes,
+                                                                                     std::size_t count,
+                                                                                     std::int32_t value)
+        {
+            const __m128i values = _mm_set1_epi32(value);
+            std::size_t index = 0;
+
+            for (; index + 4 <= count; index += 4)
+            {
+                unsigned int mismatches = ~sse2_equal_mask(codes, index, values) & 0xF;
+
+                if (mismatches != 0)
+                {
+                    return (index + std::countr_zero(mismatches));
+                }
+            }
+
+            return (index + scalar_find_first_not_equal(static_cast<const std::int32_t*>(codes) + index,
+                                                        count - index, value));
+        }
+
+        __attribute__((target("sse2"))) static std::size_t sse2_count_equal(const void* codes, std::size_t count,
+                                                                            std::int32_t value)
+        {
+            const __m128i values = _mm_set1_epi32(value);
+            std::size_t matches = 0;
+            std::size_t index = 0;
+
+            while (index + 4 <= count)
+            {
+                //  Each equal lane compares as -1, so subtracting the comparisons counts matches per lane.
+
+                std::size_t block_end = std::min(count, index + (LANE_COUNT_LIMIT * 4));
+                __m128i lane_matches = _mm_setzero_si128();
+
+                for (; index + 4 <= block_end; index += 4)
+                {
+                    __m128i block = _mm_loadu_si128(
+                        reinterpret_cast<const __m128i*>(static_cast<const std::int32_t*>(codes) + index));
+
+                    lane_matches = _mm_sub_epi32(lane_matches, _mm_cmpeq_epi32(block, values));
+                }
+
+                alignas(16) std::uint32_t lanes[4];
+
+                _mm_store_si128(reinterpret_cast<__m128i*>(lanes), lane_matches);
+                matches += std::size_t(lanes[0]) + lanes[1] + lanes[2] + lanes[3];
+            }
+
+            return (matches +
+                    scalar_count_equal(static_cast<const std::int32_t*>(codes) + index, count - index, value));
+        }
+
+        __attribute__((target("sse2"))) static void sse2_collect_equal(const void* codes, std::size_t count,
+                                                                      std::int32_t value,
+                                                                      std::vector<std::size_t>& indices)
+        {
+            const __m128i values = _mm_set1_epi32(value);
+            std::size_t index = 0;
+
+            for (; index + 4 <= count; index += 4)
+            {
+                for (unsigned int matches = sse2_equal_mask(codes, index, values); matches != 0; matches &= matches - 1)
+                {
+                    indices.push_back(index + std::countr_zero(matches));
+                }
+            }
+
+            for (; index < count; index++)
+            {
+                if (load_code(codes, index) == value)
+                {
+                    indices.push_back(index);
+                }
+            }
+        }
+
+        __attribute__((target("avx2"))) static unsigned int avx2_equal_mask(const void* codes, std::size_t index,
+                                                                            __m256i value)
+        {
+            __m256i block =
+                _mm256_loadu_si256(reinterpret_cast<const __m256i*>(static_cast<const std::int32_t*>(codes) + index));
+
+            return (
+                static_cast<unsigned int>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(block, value)))));
+        }
+
+        //  Four vectors are compared per iteration so the common case of no failures only tests one mask.
+
+        __attribute__((target("avx2"))) static std::size_t avx2_find_first_not_equal(const void* codes,
+                                                                                     std::size_t count,
+                                                                                     std::int32_t value)
+        {
+            const __m256i values = _mm256_set1_epi32(value);
+            std::size_t index = 0;
+
+            for (; index + 32 <= count; index += 32)
+            {
+                unsigned int matches =
+                    avx2_equal_mask(codes, index, values) & avx2_equal_mask(codes, index + 8, values) &
+                    avx2_equal_mask(codes, index + 16, values) & avx2_equal_mask(codes, index + 24, values);
+
+                if (matches != 0xFF)
+                {
+                    break;
+                }
+            }
+
+            for (; index + 8 <= count; index += 8)
+            {
+                unsigned int mismatches = ~avx2_equal_mask(codes, index, values) & 0xFF;
+
+                if (mismatches != 0)
+                {
+                    return (index + std::countr_zero(mismatches));
+                }
+            }
+
+            return (index + scalar_find_first_not_equal(static_cast<const std::int32_t*>(codes) + index,
+                                                        count - index, value));
+        }
+
+        __attribute__((target("avx2"))) static std::size_t avx2_count_equal(const void* codes, std::size_t count,
+                                                                            std::int32_t value)
+        {
+            const __m256i values = _mm256_set1_epi32(value);
+            std::size_t matches = 0;
+            std::size_t index = 0;
+
+            while (index + 8 <= count)
+            {
+                std::size_t block_end = std::min(count, index + (LANE_COUNT_LIMIT * 8));
+                __m256i lane_matches = _mm256_setzero_si256();
+
+                for (; index + 8 <= block_end; index += 8)
+                {
+                    __m256i block = _mm256_loadu_si256(
+                        reinterpret_cast<const __m256i*>(static_cast<const std::int32_t*>(codes) + index));
+
+                    lane_matches = _mm256_sub_epi32(lane_matches, _mm256_cmpeq_epi32(block, values));
+                }
+
+                alignas(32) std::uint32_t lanes[8];
+
+                _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), lane_matches);
+
+                for (std::uint32_t lane : lanes)
+                {
+                    matches += lane;
+                }
+            }
+
+            return (matches +
+                    scalar_count_equal(static_cast<const std::int32_t*>(codes) + index, count - index, value));
+        }
+
+        __attribute__((target("avx2"))) static void avx2_collect_equal(const void* codes, std::size_t count,
+                                                                      std::int32_t value,
+                                                                      std::vector<std::size_t>& indices)
+        {
+            const __m256i values = _mm256_set1_epi32(value);
+            std::size_t index = 0;
+
+            for (; index + 8 <= count; index += 8)
+            {
+                for (unsigned int matches = avx2_equal_mask(codes, index, values); matches != 0; matches &= matches - 1)
+                {
+                    indices.push_back(index + std::countr_zero(matches));
+                }
+            }
+
+            for (; index < count; index++)
+            {
+                if (load_code(codes, index) == value)
+                {
+                    indices.push_back(index);
+                }
+            }
+        }
+#endif
+    };
+}  // namespace SEFUtility
@@ -0,0 +1,264 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+//
+//  Compile time metadata for error code enums.  Names, severities and retry classification are declared once
+//      by specializing ErrorCodeTraits for the enum, ErrorCodeMetadata turns the declaration into a table sorted
+//      by value when the program is compiled, so describing an error code at run time is an index or a binary
+//      search over static data with no RTTI, no maps and no allocation.  For example:
+//
+//      template <>
+//      struct SEFUtility::ErrorCodeTraits<DatabaseErrors>
+//      {
+//          static constexpr SEFUtility::ErrorCodeDescription codes[] = {
+//              CPPRESULT_ERROR_CODE(DatabaseErrors::TIMEOUT, SEFUtility::ErrorSeverity::WARNING, true),
+//              CPPRESULT_ERROR_CODE(DatabaseErrors::CORRUPT, SEFUtility::ErrorSeverity::CRITICAL)};
+//      };
+//
+//      The enum name is taken from the compiler unless the traits declare 'static constexpr std::string_view
+//      name'.  Enums without traits still have a name, their codes are described as unnamed failures.
+//
+//      Each enum also has an error domain, a 64 bit hash of the compiler's name for the type computed at compile
+//      time, so testing whether a type erased Result carries a particular enum is an integer compare.  Enums
+//      in anonymous namespaces of different translation units share a compiler name and so share a domain, so
+//      the domain alone never decides that a Result may be cast to a particular Result<TErrorCodeEnum>.  The
+//      domain is stable across builds and processes, which the wire format in CPPResultSerialization.hpp
+//      relies on.
+//
+
+#define CPPRESULT_ERROR_CODE(code, ...) SEFUtility::ErrorCodeDescription((code), #code __VA_OPT__(, ) __VA_ARGS__)
+
+namespace SEFUtility
+{
+    typedef std::uint64_t ErrorDomainId;
+
+    enum class ErrorSeverity
+    {
+        NONE = 0,
+        WARNING,
+        FAILURE,
+        CRITICAL
+    };
+
+    class ErrorCodeDescription
+    {
+       public:
+        //  Any enclosing scope is removed from the name, so CPPRESULT_ERROR_CODE(Errors::TIMEOUT) is "TIMEOUT".
+
+        template <typename TErrorCodeEnum>
+        constexpr ErrorCodeDescription(TErrorCodeEnum code, std::string_view name,
+                                       ErrorSeverity severity = ErrorSeverity::FAILURE, bool retryable = false)
+            : value_(static_cast<int>(code)),
+              name_(unqualified(name)),
+              severity_(severity),
+              retryable_(retryable)
+        {
+            static_assert(std::is_enum_v<TErrorCodeEnum>, "Error codes must be enumerations");
+        }
+
+        constexpr int value() const { return (value_); }
+
+        constexpr std::string_view name() const { return (name_); }
+
+        constexpr ErrorSeverity severity() const { return (severity_); }
+
+        constexpr bool retryable() const { return (retryable_); }
+
+       private:
+        static constexpr std::string_view unqualified(std::string_view name)
+        {
+            std::size_t scope_end = name.rfind("::");
+
+            return (scope_end == std::string_view::npos ? name : name.substr(scope_end + 2));
+        }
+
+        int value_;
+
+        std::string_view name_;
+
+        ErrorSeverity severity_;
+
+        bool retryable_;
+    };
+
+    template <typename TErrorCodeEnum>
+    struct ErrorCodeTraits
+    {
+    };
+
+    template <typename TErrorCodeEnum>
+    concept DescribedErrorCode = requires
+    {
+        std::size(ErrorCodeTraits<TErrorCodeEnum>::codes);
+    };
+
+    template <typename TErrorCodeEnum>
+    concept NamedErrorCode = requires
+    {
+        std::string_view(ErrorCodeTraits<TErrorCodeEnum>::name);
+    };
+
+    template <typename TErrorCodeEnum>
+    class ErrorCodeMetadata
+    {
+       public:
+        static constexpr std::string_view enum_name()
+        {
+            if constexpr (NamedErrorCode<TErrorCodeEnum>)
+            {
+                return (ErrorCodeTraits<TErrorCodeEnum>::name);
+            }
+            else
+            {
+                return (compiler_type_name());
+            }
+        }
+
+        //  SUCCESS is always described, even when the traits omit it.  Codes missing from the traits are
+        //      described as unnamed failures which are not retryable.
+
+        static constexpr const ErrorCodeDescription& describe(TErrorCodeEnum code)
+        {
+            const int value = static_cast<int>(code);
+
+            if constexpr (DENSE)
+            {
+                if ((TABLE.size() != 0) && (value >= TABLE.front().value()) && (value <= TABLE.back().value()))
+                {
+                    return (TABLE[value - TABLE.front().value()]);
+                }
+            }
+            else
+            {
+                auto entry = std::lower_bound(TABLE.begin(), TABLE.end(), value, value_less);
+
+                if ((entry != TABLE.end()) && (entry->value() == value))
+                {
+                    return (*entry);
+                }
+            }
+
+            return (value == 0 ? SUCCESS_DESCRIPTION : UNKNOWN_DESCRIPTION);
+        }
+
+        static constexpr std::string_view name(TErrorCodeEnum code) { return (describe(code).name()); }
+
+        static constexpr ErrorSeverity severity(TErrorCodeEnum code) { return (describe(code).severity()); }
+
+        static constexpr bool retryable(TErrorCodeEnum code) { return (describe(code).retryable()); }
+
+        static constexpr std::size_t size() { return (TABLE.size()); }
+
+        static constexpr ErrorDomainId domain_id() { return (DOMAIN_ID); }
+
+       private:
+        static constexpr ErrorCodeDescription SUCCESS_DESCRIPTION{TErrorCodeEnum(), "SUCCESS", ErrorSeverity::NONE};
+        static constexpr ErrorCodeDescription UNKNOWN_DESCRIPTION{TErrorCodeEnum(), "", ErrorSeverity::FAILURE};
+
+        static constexpr bool value_less(const ErrorCodeDescription& entry, int value)
+        {
+            return (entry.value() < value);
+        }
+
+        static constexpr auto sorted_table()
+        {
+            if constexpr (DescribedErrorCode<TErrorCodeEnum>)
+            {
+                constexpr std::size_t SIZE = std::size(ErrorCodeTraits<TErrorCodeEnum>::codes);
+
+                std::array<ErrorCodeDescription, SIZE> table{[]<std::size_t... I>(std::index_sequence<I...>) {
+                    return (std::array<ErrorCodeDescription, SIZE>{ErrorCodeTraits<TErrorCodeEnum>::codes[I]...});
+                }(std::make_index_sequence<SIZE>())};
+
+                std::sort(table.begin(), table.end(), [](const ErrorCodeDescription& first,
+                                                         const ErrorCodeDescription& second) {
+                    return (first.value() < second.value());
+                });
+
+                return (table);
+            }
+            else
+            {
+                return (std::array<ErrorCodeDescription, 0>{});
+            }
+        }
+
+        static constexpr auto TABLE = sorted_table();
+
+        //  Codes covering a contiguous range of values are found by indexing rather than searching.
+
+        static constexpr bool is_dense()
+        {
+            for (std::size_t i = 1; i < TABLE.size(); i++)
+            {
+                if (TABLE[i].value() != TABLE[i - 1].value() + 1)
+                {
+                    return (false);
+                }
+            }
+
+            return (true);
+        }
+
+        static constexpr bool DENSE = is_dense();
+
+        static constexpr std::string_view compiler_type_name()
+        {
+#if defined(__clang__) || defined(__GNUC__)
+            std::string_view signature = __PRETTY_FUNCTION__;
+            std::size_t start = signature.find("TErrorCodeEnum = ") + 17;
+            std::size_t end = signature.find_first_of(";]", start);
+#elif defined(_MSC_VER)
+            std::string_view signature = __FUNCSIG__;
+            std::size_t start = signature.find("ErrorCodeMetadata<") + 18;
+            std::size_t end = signature.find(">::compiler_type_name", start);
+
+            if (signature.substr(start, 5) == "enum ")
+            {
+                start += 5;
+            }
+#else
+            std::string_view signature = "";
+            std::size_t start = 0;
+            std::size_t end = 0;
+#endif
+            return (signature.substr(start, end - start));
+        }
+
+        //  FNV-1a
+
+        static constexpr ErrorDomainId hash_type_name()
+        {
+            ErrorDomainId hash = 14695981039346656037ULL;
+
+            for (char character : compiler_type_name())
+            {
+                hash = (hash ^ static_cast<unsigned char>(character)) * 1099511628211ULL;
+            }
+
+            return (hash);
+        }
+
+        static constexpr ErrorDomainId DOMAIN_ID = hash_type_name();
+    };
+
+    //  Convenience functions deducing the enum type.
+
+    template <typename TErrorCodeEnum>
+    constexpr std::string_view error_code_name(TErrorCodeEnum code)
+    {
+        return (ErrorCodeMetadata<TErrorCodeEnum>::name(code));
+    }
+
+    template <typename TErrorCodeEnum>
+    constexpr bool is_retryable(TErrorCodeEnum code)
+    {
+        return (ErrorCodeMetadata<TErrorCodeEnum>::retryable(code));
+    }
+}  // namespace SEFUtility
@@ -1,12 +1,33 @@
 #pragma once
 
+#include <algorithm>
 #include <assert.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
 #include <memory>
+#include <memory_resource>
+#include <mutex>
 #include <optional>
+#include <ranges>
+#include <shared_mutex>
+#include <source_location>
+#include <span>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
 
 #include <fmt/format.h>
 
+#include "CPPErrorCodeTraits.hpp"
+#include "CPPResultBacktrace.hpp"
+#include "CPPResultInstrumentation.hpp"
+#include "CPPResultMemory.hpp"
+
 namespace SEFUtility
 {
     enum class BaseResultCodes
@@ -15,46 +36,989 @@ namespace SEFUtility
         FAILURE
     };
 
-    //
-    //	Base Class needed primarily for passing inner errors
-    //
+    //
+    //  Message formatted into an inline buffer, so formatting only touches the heap for messages longer than
+    //      the buffer before the text is copied into the Result's memory resource.
+    //
+
+    class FormattedMessage
+    {
+       public:
+        template <typename... Args>
+        FormattedMessage(std::string_view format, const Args&... args)
+        {
+            fmt::vformat_to(std::back_inserter(buffer_), fmt::string_view(format.data(), format.size()),
+                            fmt::make_format_args(args...));
+        }
+
+        operator std::string_view() const { return (std::string_view(buffer_.data(), buffer_.size())); }
+
+       private:
+        fmt::memory_buffer buffer_;
+    };
+
+    //
+    //  Message text with static storage duration, a Result holding one keeps only the pointer and length so
+    //      neither construction nor copying touches the message's memory resource.  The constructors are
+    //      consteval so only string literals and constexpr string views are accepted.  Frequently repeated
+    //      dynamic messages can be interned, interned text is never released.
+    //
+
+    class StaticMessage
+    {
+       public:
+        template <std::size_t N>
+        consteval explicit StaticMessage(const char (&text)[N]) : text_(text, N - 1)
+        {
+        }
+
+        consteval explicit StaticMessage(std::string_view text) : text_(text) {}
+
+        static StaticMessage intern(std::string_view text)
+        {
+            InternTable& table = intern_table();
+
+            {
+                std::shared_lock<std::shared_mutex> lock(table.mutex_);
+
+                auto interned_text = table.messages_.find(text);
+
+                if (interned_text != table.messages_.end())
+                {
+                    return (StaticMessage(InternedText(), *interned_text));
+                }
+            }
+
+            std::unique_lock<std::shared_mutex> lock(table.mutex_);
+
+            return (StaticMessage(InternedText(), *table.messages_.emplace(text).first));
+        }
+
+        constexpr std::string_view view() const { return (text_); }
+
+       private:
+        struct InternedText
+        {
+        };
+
+        struct TextHash
+        {
+            typedef void is_transparent;
+
+            std::size_t operator()(std::string_view text) const { return (std::hash<std::string_view>()(text)); }
+        };
+
+        struct InternTable
+        {
+            std::shared_mutex mutex_;
+
+            std::unordered_set<std::string, TextHash, std::equal_to<>> messages_;
+        };
+
+        //  The table is never destroyed so interned messages remain valid in Results with static storage duration.
+
+        static InternTable& intern_table()
+        {
+            static InternTable* table = new InternTable();
+
+            return (*table);
+        }
+
+        StaticMessage(InternedText, std::string_view text) : text_(text) {}
+
+        std::string_view text_;
+    };
+
+    namespace literals
+    {
+        consteval StaticMessage operator""_msg(const char* text, std::size_t length)
+        {
+            return (StaticMessage(std::string_view(text, length)));
+        }
+    }  // namespace literals
+
+    //
+    //  Message or format string paired with the source location of the call which created the failure.  The
+    //      location is captured by the default argument when the text is implicitly converted at the call site,
+    //      so failure factories record where they were called from without a macro and at no run time cost.
+    //
+
+    template <typename TText>
+    class LocatedText
+    {
+       public:
+        template <typename TSource>
+            requires std::is_convertible_v<const TSource&, TText>
+        LocatedText(const TSource& text, std::source_location location = std::source_location::current())
+            : text_(text), location_(location)
+        {
+        }
+
+        TText text() const { return (text_); }
+
+        const std::source_location& location() const { return (location_); }
+
+       private:
+        TText text_;
+
+        std::source_location location_;
+    };
+
+    typedef LocatedText<std::string_view> LocatedMessage;
+
+    //  True when every replacement field of the format string names one of the arguments and its braces
+    //      balance.  Named arguments are not supported.  Checks lazy format strings where the fmt version in use
+    //      cannot check them itself at compile time, format specs are then only checked when rendered.
+
+    constexpr bool format_string_matches(std::string_view format, std::size_t argument_count)
+    {
+        std::size_t next_argument = 0;
+        std::size_t depth = 0;
+        bool automatic_indexing = false;
+        bool manual_indexing = false;
+
+        for (std::size_t i = 0; i < format.size(); i++)
+        {
+            if (format[i] == '}')
+            {
+                if (depth > 0)
+                {
+                    depth--;
+                }
+                else if ((i + 1 < format.size()) && (format[i + 1] == '}'))
+                {
+                    i++;
+                }
+                else
+                {
+                    return (false);
+                }
+
+                continue;
+            }
+
+            if (format[i] != '{')
+            {
+                continue;
+            }
+
+            if ((depth == 0) && (i + 1 < format.size()) && (format[i + 1] == '{'))
+            {
+                i++;
+                continue;
+            }
+
+            //  A replacement field, or a nested field giving the width or precision of one.
+
+            if (++depth > 2)
+            {
+                return (false);
+            }
+
+            std::size_t argument = 0;
+            bool has_index = false;
+
+            while ((i + 1 < format.size()) && (format[i + 1] >= '0') && (format[i + 1] <= '9'))
+            {
+                argument = (argument * 10) + static_cast<std::size_t>(format[++i] - '0');
+                has_index = true;
+            }
+
+            if (has_index)
+            {
+                manual_indexing = true;
+            }
+            else
+            {
+                automatic_indexing = true;
+                argument = next_argument++;
+            }
+
+            if ((i + 1 == format.size()) || ((format[i + 1] != ':') && (format[i + 1] != '}')) ||
+                (argument >= argument_count) || (automatic_indexing && manual_indexing))
+            {
+                return (false);
+            }
+        }
+
+        return (depth == 0);
+    }
+
+    //
+    //  Format string of a lazy failure with the source location of the call which created it.  The constructor
+    //      is consteval, so only string literals are accepted and the format string is checked against the
+    //      argument types when the failure is built rather than when its message is first rendered.
+    //
+
+    template <typename... Args>
+    class LocatedFormatString
+    {
+       public:
+        template <std::size_t N>
+        consteval LocatedFormatString(const char (&format)[N],
+                                      std::source_location location = std::source_location::current())
+            : text_(format), location_(location)
+        {
+#if FMT_VERSION >= 80000
+            fmt::format_string<Args...> checked_format(format);
+
+            (void)checked_format;
+#else
+            if (!format_string_matches(std::string_view(format, N - 1), sizeof...(Args)))
+            {
+                throw fmt::format_error("lazy failure format string does not match its arguments");
+            }
+#endif
+        }
+
+        const char* text() const { return (text_); }
+
+        const std::source_location& location() const { return (location_); }
+
+       private:
+        const char* text_;
+
+        std::source_location location_;
+    };
+
+    //  The argument types are not deduced from the format string, only from the arguments which follow it.
+
+    template <typename... Args>
+    using LazyFormatString = LocatedFormatString<std::type_identity_t<Args>...>;
+
+    class ResultBase;
+
+    template <typename TErrorCodeEnum>
+    class Result;
+
+    template <typename TErrorCodeEnum, typename TResultType>
+    class ResultWithReturnValue;
+
+    //
+    //  Inner error chains are immutable and structurally shared.  Each heap allocated chain node carries an
+    //      intrusive reference count, so copying a Result shares its chain rather than cloning it.  Defining
+    //      CPPRESULT_NON_ATOMIC_REFCOUNT replaces the atomic count with a plain integer for programs that
+    //      never share Results between threads.
+    //
+
+#if defined(CPPRESULT_NON_ATOMIC_REFCOUNT)
+    typedef unsigned int ResultReferenceCount;
+#else
+    typedef std::atomic<unsigned int> ResultReferenceCount;
+#endif
+
+    class InnerErrorPtr
+    {
+       public:
+        InnerErrorPtr() = default;
+
+        InnerErrorPtr(std::nullptr_t) {}
+
+        explicit InnerErrorPtr(const ResultBase* node);
+
+        InnerErrorPtr(const InnerErrorPtr& ptr_to_copy);
+
+        InnerErrorPtr(InnerErrorPtr&& ptr_to_move) noexcept : node_(std::exchange(ptr_to_move.node_, nullptr)) {}
+
+        ~InnerErrorPtr();
+
+        InnerErrorPtr& operator=(const InnerErrorPtr& ptr_to_copy)
+        {
+            InnerErrorPtr(ptr_to_copy).swap(*this);
+
+            return (*this);
+        }
+
+        InnerErrorPtr& operator=(InnerErrorPtr&& ptr_to_move) noexcept
+        {
+            InnerErrorPtr(std::move(ptr_to_move)).swap(*this);
+
+            return (*this);
+        }
+
+        void swap(InnerErrorPtr& other) noexcept { std::swap(node_, other.node_); }
+
+        //  release() hands the reference to the caller, for example to publish the node through an atomic
+        //      pointer, and adopt() takes it back without adding another.
+
+        const ResultBase* release() noexcept { return (std::exchange(node_, nullptr)); }
+
+        static InnerErrorPtr adopt(const ResultBase* node) noexcept
+        {
+            InnerErrorPtr ptr;
+
+            ptr.node_ = node;
+
+            return (ptr);
+        }
+
+        const ResultBase* get() const { return (node_); }
+
+        const ResultBase& operator*() const { return (*node_); }
+
+        const ResultBase* operator->() const { return (node_); }
+
+        explicit operator bool() const { return (node_ != nullptr); }
+
+        friend bool operator==(const InnerErrorPtr& ptr, std::nullptr_t) { return (ptr.node_ == nullptr); }
+
+       private:
+        const ResultBase* node_ = nullptr;
+    };
+
+    //
+    //  Format string and trivially copyable arguments captured for a message that is only rendered
+    //      when it is first requested.  The format string is not copied and must be a string literal,
+    //      pointer arguments (e.g. const char*) must likewise outlive the Result.  The arguments are held in
+    //      a reference counted block from the result memory resource, see allocate_result_block(), so only
+    //      lazy failures pay for them and copies of a failure share the block.  A lazy failure which is
+    //      never read makes that one allocation and never formats.
+    //
+
+    class DeferredMessage
+    {
+       public:
+        DeferredMessage() = default;
+
+        template <typename... Args>
+        DeferredMessage(const char* format, Args... args)
+        {
+            static_assert((std::is_trivially_copyable_v<Args> && ...),
+                          "Deferred message arguments must be trivially copyable, pass strings as const char* or "
+                          "std::string_view");
+
+            auto renderer = [args...](const char* format, fmt::memory_buffer& buffer) {
+                fmt::vformat_to(std::back_inserter(buffer), fmt::string_view(format), fmt::make_format_args(args...));
+            };
+
+            typedef Arguments<decltype(renderer)> ArgumentsType;
+
+            static_assert(alignof(ArgumentsType) <= RESULT_BLOCK_HEADER_SIZE,
+                          "Deferred message arguments are over aligned");
+
+            block_ = new (allocate_result_block(sizeof(ArgumentsType)))
+                ArgumentsType{{{1}, sizeof(ArgumentsType), format, &render_arguments<decltype(renderer)>}, renderer};
+        }
+
+        DeferredMessage(const DeferredMessage& message_to_copy) : block_(message_to_copy.block_)
+        {
+            if (block_ != nullptr)
+            {
+#if defined(CPPRESULT_NON_ATOMIC_REFCOUNT)
+                block_->reference_count_++;
+#else
+                block_->reference_count_.fetch_add(1, std::memory_order_relaxed);
+#endif
+            }
+        }
+
+        DeferredMessage(DeferredMessage&& message_to_move) noexcept
+            : block_(std::exchange(message_to_move.block_, nullptr))
+        {
+        }
+
+        ~DeferredMessage()
+        {
+            if (block_ == nullptr)
+            {
+                return;
+            }
+
+#if defined(CPPRESULT_NON_ATOMIC_REFCOUNT)
+            if (--block_->reference_count_ != 0)
+#else
+            if (block_->reference_count_.fetch_sub(1, std::memory_order_acq_rel) != 1)
+#endif
+            {
+                return;
+            }
+
+            std::size_t size = block_->size_;
+
+            block_->~Block();
+            deallocate_result_block(block_, size);
+        }
+
+        DeferredMessage& operator=(DeferredMessage message_to_assign) noexcept
+        {
+            std::swap(block_, message_to_assign.block_);
+
+            return (*this);
+        }
+
+        bool pending() const { return (block_ != nullptr); }
+
+        void render(fmt::memory_buffer& buffer) const { block_->render_(*block_, buffer); }
+
+       private:
+        //  The captured arguments are trivially destructible, so a block is released without knowing its type.
+
+        struct Block
+        {
+            ResultReferenceCount reference_count_;
+
+            std::size_t size_;
+
+            const char* format_;
+
+            void (*render_)(const Block& block, fmt::memory_buffer& buffer);
+        };
+
+        template <typename TRenderer>
+        struct Arguments : Block
+        {
+            TRenderer renderer_;
+        };
+
+        template <typename TRenderer>
+        static void render_arguments(const Block& block, fmt::memory_buffer& buffer)
+        {
+            static_cast<const Arguments<TRenderer>&>(block).renderer_(block.format_, buffer);
+        }
+
+        Block* block_ = nullptr;
+    };
+
+    //  Ranges whose failed elements may become the causes of a failure.
+
+    template <typename TCauses>
+    concept ResultCauseRange =
+        std::ranges::forward_range<const TCauses> &&
+        (std::is_same_v<std::ranges::range_value_t<const TCauses>, InnerErrorPtr> ||
+         std::is_base_of_v<ResultBase, std::ranges::range_value_t<const TCauses>>);
+
+    //
+    //  The causes of a failure with more than one inner error.  All of the causes live in a single reference
+    //      counted block allocated once from the result memory resource, so copying the failure shares the
+    //      block and a failure with fifty causes is one allocation rather than a fifty node chain.
+    //
+
+    class ResultCauses
+    {
+       public:
+        ResultCauses() = default;
+
+        ResultCauses(const ResultCauses& causes_to_copy) : block_(causes_to_copy.block_)
+        {
+            if (block_ != nullptr)
+            {
+#if defined(CPPRESULT_NON_ATOMIC_REFCOUNT)
+                block_->reference_count_++;
+#else
+                block_->reference_count_.fetch_add(1, std::memory_order_relaxed);
+#endif
+            }
+        }
+
+        ResultCauses(ResultCauses&& causes_to_move) noexcept : block_(std::exchange(causes_to_move.block_, nullptr))
+        {
+        }
+
+        ~ResultCauses();
+
+        ResultCauses& operator=(ResultCauses causes_to_assign) noexcept
+        {
+            std::swap(block_, causes_to_assign.block_);
+
+            return (*this);
+        }
+
+        //  Every failed result in the range becomes a cause, successes are skipped.  The range may hold Results
+        //      of any kind or InnerErrorPtrs.
+
+        template <typename TCauses>
+        static ResultCauses from_range(const TCauses& causes);
+
+        bool empty() const { return (block_ == nullptr); }
+
+        std::span<const InnerErrorPtr> span() const
+        {
+            return (block_ == nullptr ? std::span<const InnerErrorPtr>()
+                                      : std::span<const InnerErrorPtr>(block_->causes(), block_->count_));
+        }
+
+       private:
+        struct Block
+        {
+            ResultReferenceCount reference_count_;
+
+            std::size_t count_;
+
+            InnerErrorPtr* causes() { return (reinterpret_cast<InnerErrorPtr*>(this + 1)); }
+        };
+
+        static_assert(sizeof(Block) % alignof(InnerErrorPtr) == 0);
+
+        static std::size_t block_size(std::size_t count) { return (sizeof(Block) + (count * sizeof(InnerErrorPtr))); }
+
+        Block* block_ = nullptr;
+    };
+
+    //
+    //	Base Class needed primarily for passing inner errors
+    //
+
+    class ResultBase
+    {
+       protected:
+        ResultBase(BaseResultCodes success_or_failure, ErrorDomainId error_domain, int error_code_value,
+                   std::string_view message, std::source_location location)
+            : success_or_failure_(success_or_failure),
+              error_code_value_(error_code_value),
+              error_domain_(error_domain),
+              message_(message, result_memory_resource()),
+              location_(location),
+              backtrace_(record_creation(success_or_failure, error_domain, error_code_value))
+        {
+        }
+
+        ResultBase(BaseResultCodes success_or_failure, ErrorDomainId error_domain, int error_code_value,
+                   const ResultBase& inner_error, std::string_view message, std::source_location location)
+            : success_or_failure_(success_or_failure),
+              error_code_value_(error_code_value),
+              error_domain_(error_domain),
+              message_(message, result_memory_resource()),
+              inner_error_(inner_error.as_inner_error()),
+              location_(location),
+              backtrace_(record_creation(success_or_failure, error_domain, error_code_value))
+        {
+        }
+
+        ResultBase(BaseResultCodes success_or_failure, ErrorDomainId error_domain, int error_code_value,
+                   StaticMessage message, std::source_location location)
+            : success_or_failure_(success_or_failure),
+              error_code_value_(error_code_value),
+              error_domain_(error_domain),
+              message_(result_memory_resource()),
+              static_message_(message.view()),
+              location_(location),
+              backtrace_(record_creation(success_or_failure, error_domain, error_code_value))
+        {
+        }
+
+        ResultBase(BaseResultCodes success_or_failure, ErrorDomainId error_domain, int error_code_value,
+                   const ResultBase& inner_error, StaticMessage message, std::source_location location)
+            : success_or_failure_(success_or_failure),
+              error_code_value_(error_code_value),
+              error_domain_(error_domain),
+              message_(result_memory_resource()),
+              static_message_(message.view()),
+              inner_error_(inner_error.as_inner_error()),
+              location_(location),
+              backtrace_(record_creation(success_or_failure, error_domain, error_code_value))
+        {
+        }
+
+        ResultBase(const ResultBase& result_to_copy)
+            : success_or_failure_(result_to_copy.success_or_failure_),
+              error_code_value_(result_to_copy.error_code_value_),
+              error_domain_(result_to_copy.error_domain_),
+              message_(result_to_copy.message_, result_memory_resource()),
+              static_message_(result_to_copy.static_message_),
+              deferred_message_(result_to_copy.deferred_message_),
+              inner_error_(result_to_copy.inner_error_),
+              location_(result_to_copy.location_),
+              backtrace_(result_to_copy.backtrace_),
+              causes_(result_to_copy.causes_)
+        {
+        }
+
+        ResultBase(ResultBase&& result_to_move) noexcept
+            : success_or_failure_(result_to_move.success_or_failure_),
+              error_code_value_(result_to_move.error_code_value_),
+              error_domain_(result_to_move.error_domain_),
+              message_(std::move(result_to_move.message_)),
+              static_message_(result_to_move.static_message_),
+              deferred_message_(std::move(result_to_move.deferred_message_)),
+              inner_error_(std::move(result_to_move.inner_error_)),
+              location_(result_to_move.location_),
+              backtrace_(std::move(result_to_move.backtrace_)),
+              causes_(std::move(result_to_move.causes_))
+        {
+        }
+
+        //  Assignment never transfers the reference count, which belongs to the node's own allocation.
+
+        ResultBase& operator=(const ResultBase& result_to_copy)
+        {
+            success_or_failure_ = result_to_copy.success_or_failure_;
+            error_code_value_ = result_to_copy.error_code_value_;
+            error_domain_ = result_to_copy.error_domain_;
+            message_ = result_to_copy.message_;
+            static_message_ = result_to_copy.static_message_;
+            deferred_message_ = result_to_copy.deferred_message_;
+            inner_error_ = result_to_copy.inner_error_;
+            location_ = result_to_copy.location_;
+            backtrace_ = result_to_copy.backtrace_;
+            causes_ = result_to_copy.causes_;
+
+            return (*this);
+        }
+
+        //  Move assigning a pmr string allocated from a different resource would copy it, so in that case the
+        //      message is rebuilt by move construction and keeps the resource it was allocated from, just as
+        //      it does when a result is move constructed.
+
+        ResultBase& operator=(ResultBase&& result_to_move) noexcept
+        {
+            success_or_failure_ = result_to_move.success_or_failure_;
+            error_code_value_ = result_to_move.error_code_value_;
+            error_domain_ = result_to_move.error_domain_;
+
+            if (message_.get_allocator() == result_to_move.message_.get_allocator())
+            {
+                message_.swap(result_to_move.message_);
+            }
+            else
+            {
+                std::destroy_at(&message_);
+                std::construct_at(&message_, std::move(result_to_move.message_));
+            }
+
+            static_message_ = result_to_move.static_message_;
+            deferred_message_ = std::move(result_to_move.deferred_message_);
+            inner_error_ = std::move(result_to_move.inner_error_);
+            location_ = result_to_move.location_;
+            backtrace_ = std::move(result_to_move.backtrace_);
+            causes_ = std::move(result_to_move.causes_);
+
+            return (*this);
+        }
+
+       public:
+        virtual ~ResultBase(){};
+
+        //  Heap allocated Results, which includes every inner error chain node, come from the thread's result
+        //      memory resource, see allocate_result_block().
+
+        static void* operator new(std::size_t size) { return (allocate_result_block(size)); }
+
+        static void operator delete(void* node, std::size_t size) { deallocate_result_block(node, size); }
+
+        static void* operator new(std::size_t size, std::align_val_t alignment)
+        {
+            return (::operator new(size, alignment));
+        }
+
+        static void operator delete(void* node, std::size_t size, std::align_val_t alignment)
+        {
+            ::operator delete(node, size, alignment);
+        }
+
+        //  Returns a new heap allocated chain node holding this result's status and message which shares,
+        //      rather than copies, this result's own inner error chain.
+
+        virtual InnerErrorPtr shallow_copy() const = 0;
+
+        //  Returns a reference to this result for use as an inner error, nodes already owned by a chain are
+        //      shared and only stand-alone results are copied.
+
+        InnerErrorPtr as_inner_error() const { return (is_chain_node() ? InnerErrorPtr(this) : shallow_copy()); }
+
+        bool succeeded() const { return (success_or_failure_ == BaseResultCodes::SUCCESS); }
+
+        bool failed() const { return (success_or_failure_ == BaseResultCodes::FAILURE); }
+
+        //  A deferred message is rendered on the first call, so concurrent first calls on the same
+        //      instance must be synchronized by the caller.  Its format string was checked when the failure was
+        //      built, so rendering does not throw fmt::format_error.  Chain nodes are rendered when created.
+        //      The view remains valid for the lifetime of the result.
+
+        std::string_view message() const
+        {
+            if (static_message_.data() != nullptr)
+            {
+                return (static_message_);
+            }
+
+            if (deferred_message_.pending())
+            {
+                fmt::memory_buffer buffer;
+
+                deferred_message_.render(buffer);
+                message_.assign(buffer.data(), buffer.size());
+                deferred_message_ = DeferredMessage();
+            }
+
+            return (message_);
+        }
+
+        //  For a failure with several causes the inner error is the first of them.
+
+        const InnerErrorPtr& inner_error() const { return (inner_error_); }
+
+        //  The children of this node in the error tree: every cause of a failure with several causes, otherwise
+        //      the inner error if there is one.
+
+        std::span<const InnerErrorPtr> causes() const
+        {
+            if (!causes_.empty())
+            {
+                return (causes_.span());
+            }
+
+            return (inner_error_ ? std::span<const InnerErrorPtr>(&inner_error_, 1) : std::span<const InnerErrorPtr>());
+        }
+
+        //  Where the failure was created, failures created through the factories record their caller.  The
+        //      backtrace is only captured for sampled failures, see FailureBacktrace, and is otherwise null.
+
+        const std::source_location& location() const { return (location_); }
+
+        const FailureBacktracePtr& backtrace() const { return (backtrace_); }
+
+        //  error_domain() identifies the error code enum with an integer compare, prefer it to error_code_type().
+
+        virtual const std::type_info& error_code_type() const = 0;
+
+        int error_code_value() const { return (error_code_value_); }
+
+        ErrorDomainId error_domain() const { return (error_domain_); }
+
+        //  Compile time metadata for the error code and its enum, see ErrorCodeTraits.
+
+        virtual const ErrorCodeDescription& error_code_description() const = 0;
+        virtual std::string_view error_code_enum_name() const = 0;
+
+        std::string_view error_code_name() const { return (error_code_description().name()); }
+
+        bool retryable() const { return (failed() && error_code_description().retryable()); }
+
+        //  Searches this result and then every node of its error tree depth first, in the order that
+        //      visit_depth_first visits them, comparing the integer domain and error code stored in each node.
+        //      Single cause chains are walked in a loop, only nodes with several causes recurse.  See
+        //      is_error_code_type() for how a domain match is confirmed.
+
+        template <typename TErrorCodeEnum>
+        const Result<TErrorCodeEnum>* find_in_chain() const;
+
+        template <typename TErrorCodeEnum>
+        bool contains_code(TErrorCodeEnum error_code) const;
+
+        //  Visits this result and then every node of its error tree depth first, calling the visitor with the
+        //      node and its depth below this result.  The walk reads the node fields directly, it makes no
+        //      virtual calls.
+
+        template <typename TVisitor>
+        void visit_depth_first(TVisitor&& visitor, std::size_t depth = 0) const
+        {
+            visitor(*this, depth);
+
+            for (const InnerErrorPtr& cause : causes())
+            {
+                cause->visit_depth_first(visitor, depth + 1);
+            }
+        }
+
+        //  Visits each node of the error tree, this result included, with the given error code.
+
+        template <typename TErrorCodeEnum, typename TVisitor>
+        void for_each_with_code(TErrorCodeEnum error_code, TVisitor&& visitor) const
+        {
+            constexpr ErrorDomainId domain = ErrorCodeMetadata<TErrorCodeEnum>::domain_id();
+
+            visit_depth_first([&](const ResultBase& node, std::size_t depth) {
+                if ((node.error_domain_ == domain) && (node.error_code_value_ == static_cast<int>(error_code)) &&
+                    node.is_error_code_type<TErrorCodeEnum>())
+                {
+                    visitor(static_cast<const Result<TErrorCodeEnum>&>(node), depth);
+                }
+            });
+        }
+
+        template <typename TErrorCodeEnum>
+        std::size_t count_in_tree(TErrorCodeEnum error_code) const
+        {
+            std::size_t count = 0;
+
+            for_each_with_code(error_code, [&count](const Result<TErrorCodeEnum>&, std::size_t) { count++; });
+
+            return (count);
+        }
+
+       protected:
+        bool is_chain_node() const { return (reference_count_ > 0); }
+
+        //  The domain is a hash of the enum's compiler name, so same named enums in anonymous namespaces of
+        //      different translation units share it.  Once the domain matches the type is confirmed before the
+        //      node is cast, which costs a virtual call only for nodes which are very likely a match.
+
+        template <typename TErrorCodeEnum>
+        bool is_error_code_type() const
+        {
+            return (error_code_type() == typeid(TErrorCodeEnum));
+        }
+
+        //  Called once for each result constructed with a status, so copies and moves are not counted.
+
+        static FailureBacktracePtr record_creation(BaseResultCodes success_or_failure, ErrorDomainId error_domain,
+                                                   int error_code_value)
+        {
+            if (success_or_failure == BaseResultCodes::SUCCESS)
+            {
+                return (nullptr);
+            }
+
+#if defined(CPPRESULT_ENABLE_INSTRUMENTATION)
+            FailureCounters::record(error_domain, error_code_value);
+#else
+            (void)error_domain;
+            (void)error_code_value;
+#endif
+            return (FailureBacktrace::sample());
+        }
+
+        BaseResultCodes success_or_failure_;
+
+        int error_code_value_;
+
+        ErrorDomainId error_domain_;
+
+        mutable std::pmr::string message_;
+
+        std::string_view static_message_;
+
+        mutable DeferredMessage deferred_message_;
+
+        InnerErrorPtr inner_error_;
+
+        std::source_location location_;
+
+        FailureBacktracePtr backtrace_;
+
+        ResultCauses causes_;
+
+        void set_causes(ResultCauses causes)
+        {
+            causes_ = std::move(causes);
+            inner_error_ = causes_.empty() ? InnerErrorPtr() : causes_.span().front();
+        }
+
+       private:
+        friend class InnerErrorPtr;
+
+        void add_reference() const
+        {
+#if defined(CPPRESULT_NON_ATOMIC_REFCOUNT)
+            reference_count_++;
+#else
+            reference_count_.fetch_add(1, std::memory_order_relaxed);
+#endif
+        }
+
+        bool release_reference() const
+        {
+#if defined(CPPRESULT_NON_ATOMIC_REFCOUNT)
+            return (--reference_count_ == 0);
+#else
+            return (reference_count_.fetch_sub(1, std::memory_order_acq_rel) == 1);
+#endif
+        }
+
+        mutable ResultReferenceCount reference_count_{0};
+    };
+
+    inline InnerErrorPtr::InnerErrorPtr(const ResultBase* node) : node_(node)
+    {
+        if (node_ != nullptr)
+        {
+            node_->add_reference();
+        }
+    }
 
-    class ResultBase
+    inline InnerErrorPtr::InnerErrorPtr(const InnerErrorPtr& ptr_to_copy) : InnerErrorPtr(ptr_to_copy.node_) {}
+
+    inline ResultCauses::~ResultCauses()
     {
-       protected:
-        ResultBase(BaseResultCodes success_or_failure, const std::string& message)
-            : success_or_failure_(success_or_failure), message_(message)
+        if (block_ == nullptr)
         {
+            return;
         }
 
-        ResultBase(BaseResultCodes success_or_failure, const ResultBase& inner_error, const std::string& message)
-            : success_or_failure_(success_or_failure), message_(message), inner_error_(inner_error.shallow_copy())
+#if defined(CPPRESULT_NON_ATOMIC_REFCOUNT)
+        if (--block_->reference_count_ != 0)
+#else
+        if (block_->reference_count_.fetch_sub(1, std::memory_order_acq_rel) != 1)
+#endif
         {
+            return;
         }
 
-       public:
-        virtual ~ResultBase(){};
+        std::size_t count = block_->count_;
 
-        virtual std::unique_ptr<const ResultBase> shallow_copy() const = 0;
+        for (std::size_t i = 0; i < count; i++)
+        {
+            block_->causes()[i].~InnerErrorPtr();
+        }
 
-        bool succeeded() const { return (success_or_failure_ == BaseResultCodes::SUCCESS); }
+        block_->~Block();
+        deallocate_result_block(block_, block_size(count));
+    }
 
-        bool failed() const { return (success_or_failure_ == BaseResultCodes::FAILURE); }
+    template <typename TCauses>
+    ResultCauses ResultCauses::from_range(const TCauses& causes)
+    {
+        auto is_failure = [](const auto& cause) {
+            if constexpr (std::is_same_v<std::remove_cvref_t<decltype(cause)>, InnerErrorPtr>)
+            {
+                return (cause && cause->failed());
+            }
+            else
+            {
+                return (cause.failed());
+            }
+        };
 
-        const std::string&message() const { return (message_); }
+        std::size_t count = 0;
 
-        const std::unique_ptr<const ResultBase>& inner_error() const { return (inner_error_); }
+        for (const auto& cause : causes)
+        {
+            count += is_failure(cause) ? 1 : 0;
+        }
 
-        virtual const std::type_info& error_code_type() const = 0;
-        virtual int error_code_value() const = 0;
+        ResultCauses result_causes;
 
-       protected:
-        BaseResultCodes success_or_failure_;
+        if (count == 0)
+        {
+            return (result_causes);
+        }
 
-        std::string message_;
+        //  The causes start out null so the block can be released if taking a cause throws.
 
-        std::unique_ptr<const ResultBase> inner_error_;
-    };
+        result_causes.block_ = new (allocate_result_block(block_size(count))) Block{{1}, count};
+
+        for (std::size_t i = 0; i < count; i++)
+        {
+            new (result_causes.block_->causes() + i) InnerErrorPtr();
+        }
+
+        InnerErrorPtr* next_cause = result_causes.block_->causes();
+
+        for (const auto& cause : causes)
+        {
+            if (is_failure(cause))
+            {
+                if constexpr (std::is_same_v<std::remove_cvref_t<decltype(cause)>, InnerErrorPtr>)
+                {
+                    *next_cause++ = cause;
+                }
+                else
+                {
+                    *next_cause++ = cause.as_inner_error();
+                }
+            }
+        }
+
+        return (result_causes);
+    }
+
+    inline InnerErrorPtr::~InnerErrorPtr()
+    {
+        if ((node_ != nullptr) && node_->release_reference())
+        {
+            delete node_;
+        }
+    }
 
     template <typename TErrorCodeEnum>
     class Result : public ResultBase
@@ -62,8 +1026,9 @@ namespace SEFUtility
        protected:
         typedef TErrorCodeEnum ErrorCodeType;
 
-        Result(BaseResultCodes success_or_failure, TErrorCodeEnum error_code, const std::string& message)
-            : ResultBase(success_or_failure, message), error_code_(error_code)
+        Result(BaseResultCodes success_or_failure, TErrorCodeEnum error_code, std::string_view message,
+               std::source_location location = std::source_location())
+            : ResultBase(success_or_failure, DOMAIN_ID, int(error_code), message, location)
         {
             assert((success_or_failure == BaseResultCodes::SUCCESS) ||
                    ((success_or_failure == BaseResultCodes::FAILURE) && (error_code != TErrorCodeEnum::SUCCESS)));
@@ -71,169 +1036,612 @@ namespace SEFUtility
 
         template <typename TInnerErrorCodeEnum>
         Result(BaseResultCodes success_or_failure, const Result<TInnerErrorCodeEnum>& inner_error,
-               TErrorCodeEnum error_code, const std::string& message)
-            : ResultBase(success_or_failure, inner_error, message), error_code_(error_code)
+               TErrorCodeEnum error_code, std::string_view message,
+               std::source_location location = std::source_location())
+            : ResultBase(success_or_failure, DOMAIN_ID, int(error_code), inner_error, message, location)
+        {
+            assert((success_or_failure == BaseResultCodes::SUCCESS) ||
+                   ((success_or_failure == BaseResultCodes::FAILURE) && (error_code != TErrorCodeEnum::SUCCESS)));
+        }
+
+        Result(BaseResultCodes success_or_failure, const ResultBase& inner_error, TErrorCodeEnum error_code,
+               std::string_view message, std::source_location location = std::source_location())
+            : ResultBase(success_or_failure, DOMAIN_ID, int(error_code), inner_error, message, location)
+        {
+            assert((success_or_failure == BaseResultCodes::SUCCESS) ||
+                   ((success_or_failure == BaseResultCodes::FAILURE) && (error_code != TErrorCodeEnum::SUCCESS)));
+        }
+
+        Result(BaseResultCodes success_or_failure, TErrorCodeEnum error_code, StaticMessage message,
+               std::source_location location = std::source_location())
+            : ResultBase(success_or_failure, DOMAIN_ID, int(error_code), message, location)
+        {
+            assert((success_or_failure == BaseResultCodes::SUCCESS) ||
+                   ((success_or_failure == BaseResultCodes::FAILURE) && (error_code != TErrorCodeEnum::SUCCESS)));
+        }
+
+        Result(BaseResultCodes success_or_failure, const ResultBase& inner_error, TErrorCodeEnum error_code,
+               StaticMessage message, std::source_location location = std::source_location())
+            : ResultBase(success_or_failure, DOMAIN_ID, int(error_code), inner_error, message, location)
         {
             assert((success_or_failure == BaseResultCodes::SUCCESS) ||
                    ((success_or_failure == BaseResultCodes::FAILURE) && (error_code != TErrorCodeEnum::SUCCESS)));
         }
 
-        std::unique_ptr<const ResultBase> shallow_copy() const
+        InnerErrorPtr shallow_copy() const
         {
-            return (std::unique_ptr<const ResultBase>(new Result<TErrorCodeEnum>(*this)));
+            Result<TErrorCodeEnum>* node = new Result<TErrorCodeEnum>(*this);
+
+            node->message();
+
+            return (InnerErrorPtr(node));
         }
 
        public:
         Result(const Result<TErrorCodeEnum>& result_to_copy)
-            : ResultBase(result_to_copy.success_or_failure_, result_to_copy.message_), error_code_(result_to_copy.error_code_)
+            : ResultBase(result_to_copy)
+        {
+        }
+
+        //  Moving transfers the message and inner error chain without allocating.  The moved-from
+        //  Result retains its status and error code but its message and inner error are unspecified.
+
+        Result(Result<TErrorCodeEnum>&& result_to_move) noexcept
+            : ResultBase(std::move(result_to_move))
         {
-            inner_error_ = (result_to_copy.inner_error_ ? result_to_copy.inner_error_->shallow_copy() : nullptr);
         }
 
         virtual ~Result(){};
 
         const Result<TErrorCodeEnum>& operator=(const Result<TErrorCodeEnum>& result_to_copy)
         {
-            success_or_failure_ = result_to_copy.success_or_failure_;
-            message_ = result_to_copy.message_;
-            error_code_ = result_to_copy.error_code_;
+            ResultBase::operator=(result_to_copy);
+
+            return (*this);
+        }
 
-            inner_error_ = (result_to_copy.inner_error_ ? result_to_copy.inner_error_->shallow_copy() : nullptr);
+        const Result<TErrorCodeEnum>& operator=(Result<TErrorCodeEnum>&& result_to_move) noexcept
+        {
+            ResultBase::operator=(std::move(result_to_move));
 
             return (*this);
         }
 
         static Result<TErrorCodeEnum> success()
         {
-            return (Result(BaseResultCodes::SUCCESS, TErrorCodeEnum::SUCCESS, "Success"));
+            return (Result(BaseResultCodes::SUCCESS, TErrorCodeEnum::SUCCESS, StaticMessage("Success")));
         };
 
-        static Result<TErrorCodeEnum> failure(TErrorCodeEnum error_code, const std::string& message)
+        static Result<TErrorCodeEnum> failure(TErrorCodeEnum error_code, LocatedMessage message)
         {
-            return (Result(BaseResultCodes::FAILURE, error_code, message));
+            return (Result(BaseResultCodes::FAILURE, error_code, message.text(), message.location()));
         }
 
         template <typename... Args>
-        static Result<TErrorCodeEnum> failure(TErrorCodeEnum error_code, const std::string& format, Args... args)
+        static Result<TErrorCodeEnum> failure(TErrorCodeEnum error_code, LocatedMessage format, Args... args)
         {
-            return (Result(BaseResultCodes::FAILURE, error_code, fmt::format(format, args...)));
+            return (Result(BaseResultCodes::FAILURE, error_code, FormattedMessage(format.text(), args...),
+                           format.location()));
         }
 
         template <typename TInnerErrorCodeEnum>
         static Result<TErrorCodeEnum> failure(const Result<TInnerErrorCodeEnum>& inner_error, TErrorCodeEnum error_code,
-                                              const std::string& message)
+                                              LocatedMessage message)
         {
-            return (Result(BaseResultCodes::FAILURE, inner_error, error_code, message));
+            return (Result(BaseResultCodes::FAILURE, inner_error, error_code, message.text(), message.location()));
         }
 
         template <typename TInnerErrorCodeEnum, typename... Args>
         static Result<TErrorCodeEnum> failure(const Result<TInnerErrorCodeEnum>& inner_error, TErrorCodeEnum error_code,
-                                              const std::string& format, Args... args)
+                                              LocatedMessage format, Args... args)
+        {
+            return (Result(BaseResultCodes::FAILURE, inner_error, error_code, FormattedMessage(format.text(), args...),
+                           format.location()));
+        }
+
+        //  Wraps an inner error known only through its base class, e.g. the inner_error() of another Result.
+
+        static Result<TErrorCodeEnum> failure(const ResultBase& inner_error, TErrorCodeEnum error_code,
+                                              LocatedMessage message)
+        {
+            return (Result(BaseResultCodes::FAILURE, inner_error, error_code, message.text(), message.location()));
+        }
+
+        template <typename... Args>
+        static Result<TErrorCodeEnum> failure(const ResultBase& inner_error, TErrorCodeEnum error_code,
+                                              LocatedMessage format, Args... args)
+        {
+            return (Result(BaseResultCodes::FAILURE, inner_error, error_code, FormattedMessage(format.text(), args...),
+                           format.location()));
+        }
+
+        //  Static messages are referenced rather than copied, see StaticMessage.
+
+        static Result<TErrorCodeEnum> failure(TErrorCodeEnum error_code, StaticMessage message,
+                                              std::source_location location = std::source_location::current())
+        {
+            return (Result(BaseResultCodes::FAILURE, error_code, message, location));
+        }
+
+        static Result<TErrorCodeEnum> failure(const ResultBase& inner_error, TErrorCodeEnum error_code,
+                                              StaticMessage message,
+                                              std::source_location location = std::source_location::current())
+        {
+            return (Result(BaseResultCodes::FAILURE, inner_error, error_code, message, location));
+        }
+
+        //  A failure with several causes, e.g. the failures of work fanned out in parallel.  The failed elements of
+        //      the range become the causes, held in one block, and the first of them is also the inner error.
+
+        template <typename TCauses>
+            requires ResultCauseRange<TCauses>
+        static Result<TErrorCodeEnum> failure(const TCauses& causes, TErrorCodeEnum error_code, LocatedMessage message)
+        {
+            Result result(BaseResultCodes::FAILURE, error_code, message.text(), message.location());
+            result.set_causes(ResultCauses::from_range(causes));
+            return (result);
+        }
+
+        template <typename TCauses, typename... Args>
+            requires ResultCauseRange<TCauses>
+        static Result<TErrorCodeEnum> failure(const TCauses& causes, TErrorCodeEnum error_code, LocatedMessage format,
+                                              Args... args)
         {
-            return (Result(BaseResultCodes::FAILURE, inner_error, error_code, fmt::format(format, args...)));
+            Result result(BaseResultCodes::FAILURE, error_code, FormattedMessage(format.text(), args...),
+                          format.location());
+            result.set_causes(ResultCauses::from_range(causes));
+            return (result);
         }
 
-        TErrorCodeEnum error_code() const { return (error_code_); }
+        //  Lazy failures capture the format string and arguments and only format the message when
+        //      message() is first called.  See DeferredMessage for the restrictions on the arguments.
+
+        template <typename... Args>
+        static Result<TErrorCodeEnum> lazy_failure(TErrorCodeEnum error_code, LazyFormatString<Args...> format,
+                                                   Args... args)
+        {
+            Result result(BaseResultCodes::FAILURE, error_code, std::string_view(), format.location());
+            result.deferred_message_ = DeferredMessage(format.text(), args...);
+            return (result);
+        }
+
+        template <typename TInnerErrorCodeEnum, typename... Args>
+        static Result<TErrorCodeEnum> lazy_failure(
+            const Result<TInnerErrorCodeEnum>& inner_error, TErrorCodeEnum error_code, LazyFormatString<Args...> format,
+            Args... args)
+        {
+            Result result(BaseResultCodes::FAILURE, inner_error, error_code, std::string_view(), format.location());
+            result.deferred_message_ = DeferredMessage(format.text(), args...);
+            return (result);
+        }
+
+        TErrorCodeEnum error_code() const { return (static_cast<TErrorCodeEnum>(this->error_code_value_)); }
+
+        //  Views a Result carrying a return value as its base in place, nothing is constructed or copied and the
+        //      inner error chain is the one held by this Result.
+
+        const Result<TErrorCodeEnum>& as_result() const { return (*this); }
+
+        //  Slices the status, message and inner error into a stand alone Result.  Calling to_result() on an rvalue
+        //      moves the message and inner error rather than copying them, leaving the return value behind.
+
+        Result<TErrorCodeEnum> to_result() const& { return (Result<TErrorCodeEnum>(as_result())); }
+
+        Result<TErrorCodeEnum> to_result() && { return (Result<TErrorCodeEnum>(std::move(*this))); }
 
         const std::type_info& error_code_type() const { return (typeid(ErrorCodeType)); }
 
-        int error_code_value() const { return ((int)error_code_); }
+        const ErrorCodeDescription& error_code_description() const
+        {
+            return (ErrorCodeMetadata<TErrorCodeEnum>::describe(error_code()));
+        }
+
+        std::string_view error_code_enum_name() const { return (ErrorCodeMetadata<TErrorCodeEnum>::enum_name()); }
+
+        //  Resolved statically rather than through error_code_description() when the Result's type is known.
+
+        std::string_view error_code_name() const { return (ErrorCodeMetadata<TErrorCodeEnum>::name(error_code())); }
+
+        bool retryable() const
+        {
+            return (this->failed() && ErrorCodeMetadata<TErrorCodeEnum>::retryable(error_code()));
+        }
 
        protected:
-        TErrorCodeEnum error_code_;
+        //  Shared implementation of the monadic operations of the Results carrying a value.  The failure is
+        //      moved or copied into the returned Result according to the value category of self, so propagating
+        //      a failure never clones its inner error chain.  get_payload is only called on success.
+
+        template <typename TSelf, typename TFunction, typename TGetPayload>
+        static auto and_then_impl(TSelf&& self, TFunction&& function, TGetPayload get_payload)
+        {
+            typedef std::remove_cvref_t<std::invoke_result_t<TFunction, decltype(get_payload())>> ContinuationResult;
+
+            static_assert(std::is_base_of_v<Result<TErrorCodeEnum>, ContinuationResult>,
+                          "and_then() continuations must return a Result with the same error code type");
+
+            if (self.failed())
+            {
+                return (ContinuationResult(Result<TErrorCodeEnum>(std::forward<TSelf>(self))));
+            }
+
+            return (std::invoke(std::forward<TFunction>(function), get_payload()));
+        }
+
+        template <typename TSelf, typename TFunction, typename TGetPayload>
+        static auto transform_impl(TSelf&& self, TFunction&& function, TGetPayload get_payload)
+        {
+            typedef std::invoke_result_t<TFunction, decltype(get_payload())> TransformedType;
+
+            if constexpr (std::is_void_v<TransformedType>)
+            {
+                if (self.failed())
+                {
+                    return (Result<TErrorCodeEnum>(std::forward<TSelf>(self)));
+                }
+
+                std::invoke(std::forward<TFunction>(function), get_payload());
+
+                return (Result<TErrorCodeEnum>::success());
+            }
+            else
+            {
+                typedef ResultWithReturnValue<TErrorCodeEnum, std::remove_cvref_t<TransformedType>> TransformedResult;
+
+                if (self.failed())
+                {
+                    return (TransformedResult(Result<TErrorCodeEnum>(std::forward<TSelf>(self))));
+                }
+
+                return (TransformedResult(std::invoke(std::forward<TFunction>(function), get_payload())));
+            }
+        }
+
+        template <typename TSelf, typename TFunction, typename TGetPayload>
+        static auto or_else_impl(TSelf&& self, TFunction&& function, TGetPayload get_payload)
+        {
+            typedef std::remove_cvref_t<std::invoke_result_t<TFunction, TSelf&&>> RecoveryResult;
+
+            if (self.succeeded())
+            {
+                if constexpr (std::is_same_v<RecoveryResult, std::remove_cvref_t<TSelf>>)
+                {
+                    return (RecoveryResult(std::forward<TSelf>(self)));
+                }
+                else
+                {
+                    return (RecoveryResult(get_payload()));
+                }
+            }
+
+            return (std::invoke(std::forward<TFunction>(function), std::forward<TSelf>(self)));
+        }
+
+        static constexpr ErrorDomainId DOMAIN_ID = ErrorCodeMetadata<TErrorCodeEnum>::domain_id();
     };
 
+    template <typename TErrorCodeEnum>
+    const Result<TErrorCodeEnum>* ResultBase::find_in_chain() const
+    {
+        constexpr ErrorDomainId domain = ErrorCodeMetadata<TErrorCodeEnum>::domain_id();
+
+        for (const ResultBase* node = this; node != nullptr; node = node->inner_error_.get())
+        {
+            if ((node->error_domain_ == domain) && node->is_error_code_type<TErrorCodeEnum>())
+            {
+                return (static_cast<const Result<TErrorCodeEnum>*>(node));
+            }
+
+            if (!node->causes_.empty())
+            {
+                for (const InnerErrorPtr& cause : node->causes_.span())
+                {
+                    if (const Result<TErrorCodeEnum>* found = cause->find_in_chain<TErrorCodeEnum>(); found != nullptr)
+                    {
+                        return (found);
+                    }
+                }
+
+                return (nullptr);
+            }
+        }
+
+        return (nullptr);
+    }
+
+    template <typename TErrorCodeEnum>
+    bool ResultBase::contains_code(TErrorCodeEnum error_code) const
+    {
+        constexpr ErrorDomainId domain = ErrorCodeMetadata<TErrorCodeEnum>::domain_id();
+
+        for (const ResultBase* node = this; node != nullptr; node = node->inner_error_.get())
+        {
+            if ((node->error_domain_ == domain) && (node->error_code_value_ == static_cast<int>(error_code)) &&
+                node->is_error_code_type<TErrorCodeEnum>())
+            {
+                return (true);
+            }
+
+            if (!node->causes_.empty())
+            {
+                for (const InnerErrorPtr& cause : node->causes_.span())
+                {
+                    if (cause->contains_code(error_code))
+                    {
+                        return (true);
+                    }
+                }
+
+                return (false);
+            }
+        }
+
+        return (false);
+    }
+
     template <typename TErrorCodeEnum, typename TResultType>
     class ResultWithReturnValue : public Result<TErrorCodeEnum>
     {
        protected:
-        ResultWithReturnValue(BaseResultCodes success_or_failure, TErrorCodeEnum error_code, const std::string& message)
-            : Result<TErrorCodeEnum>(success_or_failure, error_code, message)
+        ResultWithReturnValue(BaseResultCodes success_or_failure, TErrorCodeEnum error_code, std::string_view message,
+                              std::source_location location = std::source_location())
+            : Result<TErrorCodeEnum>(success_or_failure, error_code, message, location)
+        {
+        }
+
+        template <typename TInnerErrorCodeEnum>
+        ResultWithReturnValue(BaseResultCodes success_or_failure, const Result<TInnerErrorCodeEnum>& inner_error,
+                              TErrorCodeEnum error_code, std::string_view message,
+                              std::source_location location = std::source_location())
+            : Result<TErrorCodeEnum>(success_or_failure, inner_error, error_code, message, location)
+        {
+        }
+
+        ResultWithReturnValue(BaseResultCodes success_or_failure, TErrorCodeEnum error_code, StaticMessage message,
+                              std::source_location location = std::source_location())
+            : Result<TErrorCodeEnum>(success_or_failure, error_code, message, location)
+        {
+        }
+
+        ResultWithReturnValue(BaseResultCodes success_or_failure, const ResultBase& inner_error,
+                              TErrorCodeEnum error_code, StaticMessage message,
+                              std::source_location location = std::source_location())
+            : Result<TErrorCodeEnum>(success_or_failure, inner_error, error_code, message, location)
+        {
+        }
+
+       public:
+        ResultWithReturnValue(const TResultType& return_value)
+            : Result<TErrorCodeEnum>(BaseResultCodes::SUCCESS, TErrorCodeEnum::SUCCESS, StaticMessage("Success")),
+              return_value_(return_value)
+        {
+        }
+
+        ResultWithReturnValue(TResultType&& return_value)
+            : Result<TErrorCodeEnum>(BaseResultCodes::SUCCESS, TErrorCodeEnum::SUCCESS, StaticMessage("Success")),
+              return_value_(std::move(return_value))
+        {
+        }
+
+        //  Constructs the return value in place from the arguments, the value is neither copied nor moved.
+
+        template <typename... Args>
+        explicit ResultWithReturnValue(std::in_place_t, Args&&... args)
+            : Result<TErrorCodeEnum>(BaseResultCodes::SUCCESS, TErrorCodeEnum::SUCCESS, StaticMessage("Success")),
+              return_value_(std::in_place, std::forward<Args>(args)...)
+        {
+        }
+
+        //  Propagates a failure with the same error code type, taking over its message and inner error chain.
+
+        explicit ResultWithReturnValue(Result<TErrorCodeEnum>&& failure)
+            : Result<TErrorCodeEnum>(std::move(failure))
+        {
+            assert(this->failed());
+        }
+
+        ResultWithReturnValue(const ResultWithReturnValue& result_to_copy)
+            : Result<TErrorCodeEnum>(result_to_copy), return_value_(result_to_copy.return_value_)
+        {
+        }
+
+        ResultWithReturnValue(ResultWithReturnValue&& result_to_move) noexcept(
+            std::is_nothrow_move_constructible_v<TResultType>)
+            : Result<TErrorCodeEnum>(std::move(result_to_move)), return_value_(std::move(result_to_move.return_value_))
+        {
+        }
+
+        virtual ~ResultWithReturnValue(){};
+
+        const ResultWithReturnValue<TErrorCodeEnum, TResultType>& operator=(
+            const ResultWithReturnValue<TErrorCodeEnum, TResultType>& result_to_copy)
+        {
+            Result<TErrorCodeEnum>::operator=(result_to_copy);
+            return_value_ = result_to_copy.return_value_;
+
+            return (*this);
+        }
+
+        const ResultWithReturnValue<TErrorCodeEnum, TResultType>& operator=(
+            ResultWithReturnValue<TErrorCodeEnum, TResultType>&& result_to_move) noexcept(
+            std::is_nothrow_move_assignable_v<TResultType> && std::is_nothrow_move_constructible_v<TResultType>)
+        {
+            return_value_ = std::move(result_to_move.return_value_);
+            Result<TErrorCodeEnum>::operator=(std::move(result_to_move));
+
+            return (*this);
+        }
+
+        static ResultWithReturnValue<TErrorCodeEnum, TResultType> success(const TResultType& return_value)
+        {
+            return (ResultWithReturnValue(return_value));
+        };
+
+        static ResultWithReturnValue<TErrorCodeEnum, TResultType> success(TResultType&& return_value)
+        {
+            return (ResultWithReturnValue(std::move(return_value)));
+        };
+
+        //  For example success(std::in_place, size, fill) builds a std::vector directly inside the Result, which
+        //      is itself returned without a copy or move.
+
+        template <typename... Args>
+        static ResultWithReturnValue<TErrorCodeEnum, TResultType> success(std::in_place_t, Args&&... args)
+        {
+            return (ResultWithReturnValue(std::in_place, std::forward<Args>(args)...));
+        };
+
+        static ResultWithReturnValue<TErrorCodeEnum, TResultType> failure(TErrorCodeEnum error_code,
+                                                                          LocatedMessage message)
+        {
+            return (ResultWithReturnValue(BaseResultCodes::FAILURE, error_code, message.text(), message.location()));
+        }
+
+        template <typename... Args>
+        static ResultWithReturnValue<TErrorCodeEnum, TResultType> failure(TErrorCodeEnum error_code,
+                                                                          LocatedMessage format, Args... args)
+        {
+            return (ResultWithReturnValue(BaseResultCodes::FAILURE, error_code,
+                                          FormattedMessage(format.text(), args...), format.location()));
+        }
+
+        template <typename TInnerErrorCodeEnum>
+        static ResultWithReturnValue<TErrorCodeEnum, TResultType> failure(const Result<TInnerErrorCodeEnum>& inner_error,
+                                                                          TErrorCodeEnum error_code,
+                                                                          LocatedMessage message)
+        {
+            return (ResultWithReturnValue(BaseResultCodes::FAILURE, inner_error, error_code, message.text(),
+                                          message.location()));
+        }
+
+        template <typename TInnerErrorCodeEnum, typename... Args>
+        static ResultWithReturnValue<TErrorCodeEnum, TResultType> failure(const Result<TInnerErrorCodeEnum>& inner_error,
+                                                                          TErrorCodeEnum error_code,
+                                                                          LocatedMessage format, Args... args)
+        {
+            return (ResultWithReturnValue(BaseResultCodes::FAILURE, inner_error, error_code,
+                                          FormattedMessage(format.text(), args...), format.location()));
+        }
+
+        static ResultWithReturnValue<TErrorCodeEnum, TResultType> failure(
+            TErrorCodeEnum error_code, StaticMessage message,
+            std::source_location location = std::source_location::current())
+        {
+            return (ResultWithReturnValue(BaseResultCodes::FAILURE, error_code, message, location));
+        }
+
+        static ResultWithReturnValue<TErrorCodeEnum, TResultType> failure(
+            const ResultBase& inner_error, TErrorCodeEnum error_code, StaticMessage message,
+            std::source_location location = std::source_location::current())
+        {
+            return (ResultWithReturnValue(BaseResultCodes::FAILURE, inner_error, error_code, message, location));
+        }
+
+        template <typename... Args>
+        static ResultWithReturnValue<TErrorCodeEnum, TResultType> lazy_failure(
+            TErrorCodeEnum error_code, LazyFormatString<Args...> format, Args... args)
         {
+            ResultWithReturnValue result(BaseResultCodes::FAILURE, error_code, std::string_view(), format.location());
+            result.deferred_message_ = DeferredMessage(format.text(), args...);
+            return (result);
         }
 
-        template <typename TInnerErrorCodeEnum>
-        ResultWithReturnValue(BaseResultCodes success_or_failure, const Result<TInnerErrorCodeEnum>& inner_error,
-                              TErrorCodeEnum error_code, const std::string& message)
-            : Result<TErrorCodeEnum>(success_or_failure, inner_error, error_code, message)
+        template <typename TInnerErrorCodeEnum, typename... Args>
+        static ResultWithReturnValue<TErrorCodeEnum, TResultType> lazy_failure(
+            const Result<TInnerErrorCodeEnum>& inner_error, TErrorCodeEnum error_code, LazyFormatString<Args...> format,
+            Args... args)
         {
+            ResultWithReturnValue result(BaseResultCodes::FAILURE, inner_error, error_code, std::string_view(),
+                                         format.location());
+            result.deferred_message_ = DeferredMessage(format.text(), args...);
+            return (result);
         }
 
-       public:
-        ResultWithReturnValue(TResultType return_value)
-            : Result<TErrorCodeEnum>(BaseResultCodes::SUCCESS, TErrorCodeEnum::SUCCESS, "Success"),
-              return_value_(return_value)
+        TResultType& return_value()
         {
+            assert(return_value_);
+            return (*return_value_);
         }
 
-        ResultWithReturnValue(const ResultWithReturnValue& result_to_copy)
-            : Result<TErrorCodeEnum>(result_to_copy.success_or_failure_, result_to_copy.error_code_, result_to_copy.message_),
-              return_value_(result_to_copy.return_value_)
+        const TResultType& return_value() const
         {
-            this->inner_error_ = (result_to_copy.inner_error_ ? result_to_copy.inner_error_->shallow_copy() : nullptr);
+            assert(return_value_);
+            return (*return_value_);
         }
 
-        virtual ~ResultWithReturnValue(){};
+        //  Monadic operations named after those of std::expected.  On an rvalue the payload is moved into the
+        //      continuation and a failure is moved into the Result returned, so no step copies either.
 
-        operator const Result<TErrorCodeEnum>&() const
+        template <typename TFunction>
+        auto and_then(TFunction&& function) &
         {
-            return (Result<TErrorCodeEnum>(this->success_or_failure_, this->error_code_, this->message_));
+            auto payload = [this]() -> TResultType& { return (*return_value_); };
+
+            return (this->and_then_impl(*this, std::forward<TFunction>(function), payload));
         }
 
-        const ResultWithReturnValue<TErrorCodeEnum, TResultType>& operator=(
-            const ResultWithReturnValue<TErrorCodeEnum, TResultType>& result_to_copy)
+        template <typename TFunction>
+        auto and_then(TFunction&& function) &&
         {
-            ResultBase::success_or_failure_ = result_to_copy.success_or_failure_;
-            ResultBase::message_ = result_to_copy.message_;
-            Result<TErrorCodeEnum>::error_code_ = result_to_copy.error_code_;
-            return_value_ = result_to_copy.return_value_;
+            auto payload = [this]() -> TResultType&& { return (std::move(*return_value_)); };
 
-            this->inner_error_ = (result_to_copy.inner_error_ ? result_to_copy.inner_error_->shallow_copy() : nullptr);
-
-            return (*this);
+            return (this->and_then_impl(std::move(*this), std::forward<TFunction>(function), payload));
         }
 
-        static ResultWithReturnValue<TErrorCodeEnum, TResultType> success(const TResultType& return_value)
+        template <typename TFunction>
+        auto transform(TFunction&& function) &
         {
-            return (ResultWithReturnValue(return_value));
-        };
+            auto payload = [this]() -> TResultType& { return (*return_value_); };
 
-        static ResultWithReturnValue<TErrorCodeEnum, TResultType> failure(TErrorCodeEnum error_code,
-                                                                          const std::string& message)
-        {
-            return (ResultWithReturnValue(BaseResultCodes::FAILURE, error_code, message));
+            return (this->transform_impl(*this, std::forward<TFunction>(function), payload));
         }
 
-        template <typename... Args>
-        static ResultWithReturnValue<TErrorCodeEnum, TResultType> failure(TErrorCodeEnum error_code,
-                                                                          const std::string& format, Args... args)
+        template <typename TFunction>
+        auto transform(TFunction&& function) &&
         {
-            return (ResultWithReturnValue(BaseResultCodes::FAILURE, error_code, fmt::format(format, args...)));
+            auto payload = [this]() -> TResultType&& { return (std::move(*return_value_)); };
+
+            return (this->transform_impl(std::move(*this), std::forward<TFunction>(function), payload));
         }
 
-        template <typename TInnerErrorCodeEnum>
-        static ResultWithReturnValue<TErrorCodeEnum, TResultType> failure(const Result<TInnerErrorCodeEnum>& inner_error,
-                                                                          TErrorCodeEnum error_code,
-                                                                          const std::string& message)
+        template <typename TFunction>
+        auto or_else(TFunction&& function) &
         {
-            return (ResultWithReturnValue(BaseResultCodes::FAILURE, inner_error, error_code, message));
+            auto payload = [this]() -> TResultType& { return (*return_value_); };
+
+            return (this->or_else_impl(*this, std::forward<TFunction>(function), payload));
         }
 
-        template <typename TInnerErrorCodeEnum, typename... Args>
-        static ResultWithReturnValue<TErrorCodeEnum, TResultType> failure(const Result<TInnerErrorCodeEnum>& inner_error,
-                                                                          TErrorCodeEnum error_code,
-                                                                          const std::string& format, Args... args)
+        template <typename TFunction>
+        auto or_else(TFunction&& function) &&
         {
-            return (
-                ResultWithReturnValue(BaseResultCodes::FAILURE, inner_error, error_code, fmt::format(format, args...)));
+            auto payload = [this]() -> TResultType&& { return (std::move(*return_value_)); };
+
+            return (this->or_else_impl(std::move(*this), std::forward<TFunction>(function), payload));
         }
 
-        TResultType& return_value()
+        template <typename TDefault>
+        TResultType value_or(TDefault&& default_value) const&
         {
-            assert(return_value_);
+            if (this->failed())
+            {
+                return (static_cast<TResultType>(std::forward<TDefault>(default_value)));
+            }
+
             return (*return_value_);
         }
 
+        template <typename TDefault>
+        TResultType value_or(TDefault&& default_value) &&
+        {
+            if (this->failed())
+            {
+                return (static_cast<TResultType>(std::forward<TDefault>(default_value)));
+            }
+
+            return (std::move(*return_value_));
+        }
+
        protected:
         std::optional<TResultType> return_value_;
     };
@@ -242,79 +1650,142 @@ namespace SEFUtility
     class ResultWithReturnRef : public Result<TErrorCodeEnum>
     {
        protected:
-        ResultWithReturnRef(BaseResultCodes success_or_failure, TErrorCodeEnum error_code, const std::string& message)
-            : Result<TErrorCodeEnum>(success_or_failure, error_code, message)
+        ResultWithReturnRef(BaseResultCodes success_or_failure, TErrorCodeEnum error_code, std::string_view message,
+                            std::source_location location = std::source_location())
+            : Result<TErrorCodeEnum>(success_or_failure, error_code, message, location)
         {
         }
 
         template <typename TInnerErrorCodeEnum>
         ResultWithReturnRef(BaseResultCodes success_or_failure, const Result<TInnerErrorCodeEnum>& inner_error,
-                            TErrorCodeEnum error_code, const std::string& message)
-            : Result<TErrorCodeEnum>(success_or_failure, inner_error, error_code, message)
+                            TErrorCodeEnum error_code, std::string_view message,
+                            std::source_location location = std::source_location())
+            : Result<TErrorCodeEnum>(success_or_failure, inner_error, error_code, message, location)
+        {
+        }
+
+        ResultWithReturnRef(BaseResultCodes success_or_failure, TErrorCodeEnum error_code, StaticMessage message,
+                            std::source_location location = std::source_location())
+            : Result<TErrorCodeEnum>(success_or_failure, error_code, message, location)
+        {
+        }
+
+        ResultWithReturnRef(BaseResultCodes success_or_failure, const ResultBase& inner_error,
+                            TErrorCodeEnum error_code, StaticMessage message,
+                            std::source_location location = std::source_location())
+            : Result<TErrorCodeEnum>(success_or_failure, inner_error, error_code, message, location)
         {
         }
 
        public:
         ResultWithReturnRef(TResultType& return_ref)
-            : Result<TErrorCodeEnum>(BaseResultCodes::SUCCESS, TErrorCodeEnum::SUCCESS, "Success"),
+            : Result<TErrorCodeEnum>(BaseResultCodes::SUCCESS, TErrorCodeEnum::SUCCESS, StaticMessage("Success")),
               return_ref_(return_ref)
         {
         }
 
-        ResultWithReturnRef(const ResultWithReturnRef& result_to_copy)
-            : Result<TErrorCodeEnum>(result_to_copy.success_or_failure_, result_to_copy.error_code_, result_to_copy.message_),
-              return_ref_(result_to_copy.return_ref_)
+        //  Propagates a failure with the same error code type, taking over its message and inner error chain.
+
+        explicit ResultWithReturnRef(Result<TErrorCodeEnum>&& failure)
+            : Result<TErrorCodeEnum>(std::move(failure))
         {
-            this->inner_error_ = (result_to_copy.inner_error_ ? result_to_copy.inner_error_->shallow_copy() : nullptr);
+            assert(this->failed());
         }
 
-        virtual ~ResultWithReturnRef(){};
+        ResultWithReturnRef(const ResultWithReturnRef& result_to_copy)
+            : Result<TErrorCodeEnum>(result_to_copy), return_ref_(result_to_copy.return_ref_)
+        {
+        }
 
-        operator const Result<TErrorCodeEnum>&() const
+        ResultWithReturnRef(ResultWithReturnRef&& result_to_move) noexcept
+            : Result<TErrorCodeEnum>(std::move(result_to_move)), return_ref_(result_to_move.return_ref_)
         {
-            return (Result<TErrorCodeEnum>(this->success_or_failure_, this->error_code_, this->message_));
         }
 
+        virtual ~ResultWithReturnRef(){};
+
         const ResultWithReturnRef<TErrorCodeEnum, TResultType>& operator=(
             const ResultWithReturnRef<TErrorCodeEnum, TResultType>& result_to_copy)
         {
-            ResultBase::success_or_failure_ = result_to_copy.success_or_failure_;
-            ResultBase::message_ = result_to_copy.message_;
-            Result<TErrorCodeEnum>::error_code_ = result_to_copy.error_code_;
+            Result<TErrorCodeEnum>::operator=(result_to_copy);
             return_ref_ = result_to_copy.return_ref_;
 
-            this->inner_error_ = (result_to_copy.inner_error_ ? result_to_copy.inner_error_->shallow_copy() : nullptr);
+            return (*this);
+        }
+
+        const ResultWithReturnRef<TErrorCodeEnum, TResultType>& operator=(
+            ResultWithReturnRef<TErrorCodeEnum, TResultType>&& result_to_move) noexcept
+        {
+            return_ref_ = result_to_move.return_ref_;
+            Result<TErrorCodeEnum>::operator=(std::move(result_to_move));
 
             return (*this);
         }
 
         static ResultWithReturnRef<TErrorCodeEnum, TResultType> failure(TErrorCodeEnum error_code,
-                                                                        const std::string& message)
+                                                                        LocatedMessage message)
         {
-            return (ResultWithReturnRef(BaseResultCodes::FAILURE, error_code, message));
+            return (ResultWithReturnRef(BaseResultCodes::FAILURE, error_code, message.text(), message.location()));
         }
 
         template <typename... Args>
         static ResultWithReturnRef<TErrorCodeEnum, TResultType> failure(TErrorCodeEnum error_code,
-                                                                        const std::string& format, Args... args)
+                                                                        LocatedMessage format, Args... args)
         {
-            return (ResultWithReturnRef(BaseResultCodes::FAILURE, error_code, fmt::format(format, args...)));
+            return (ResultWithReturnRef(BaseResultCodes::FAILURE, error_code, FormattedMessage(format.text(), args...),
+                                        format.location()));
         }
 
         template <typename TInnerErrorCodeEnum>
         static ResultWithReturnRef<TErrorCodeEnum, TResultType> failure(const Result<TInnerErrorCodeEnum>& inner_error,
                                                                         TErrorCodeEnum error_code,
-                                                                        const std::string& message)
+                                                                        LocatedMessage message)
         {
-            return (ResultWithReturnRef(BaseResultCodes::FAILURE, inner_error, error_code, message));
+            return (ResultWithReturnRef(BaseResultCodes::FAILURE, inner_error, error_code, message.text(),
+                                        message.location()));
         }
 
         template <typename TInnerErrorCodeEnum, typename... Args>
         static ResultWithReturnRef<TErrorCodeEnum, TResultType> failure(const Result<TInnerErrorCodeEnum>& inner_error,
                                                                         TErrorCodeEnum error_code,
-                                                                        const std::string& format, Args... args)
+                                                                        LocatedMessage format, Args... args)
+        {
+            return (ResultWithReturnRef(BaseResultCodes::FAILURE, inner_error, error_code,
+                                        FormattedMessage(format.text(), args...), format.location()));
+        }
+
+        static ResultWithReturnRef<TErrorCodeEnum, TResultType> failure(
+            TErrorCodeEnum error_code, StaticMessage message,
+            std::source_location location = std::source_location::current())
+        {
+            return (ResultWithReturnRef(BaseResultCodes::FAILURE, error_code, message, location));
+        }
+
+        static ResultWithReturnRef<TErrorCodeEnum, TResultType> failure(
+            const ResultBase& inner_error, TErrorCodeEnum error_code, StaticMessage message,
+            std::source_location location = std::source_location::current())
+        {
+            return (ResultWithReturnRef(BaseResultCodes::FAILURE, inner_error, error_code, message, location));
+        }
+
+        template <typename... Args>
+        static ResultWithReturnRef<TErrorCodeEnum, TResultType> lazy_failure(
+            TErrorCodeEnum error_code, LazyFormatString<Args...> format, Args... args)
         {
-            return (ResultWithReturnRef(BaseResultCodes::FAILURE, inner_error, error_code, fmt::format(format, args...)));
+            ResultWithReturnRef result(BaseResultCodes::FAILURE, error_code, std::string_view(), format.location());
+            result.deferred_message_ = DeferredMessage(format.text(), args...);
+            return (result);
+        }
+
+        template <typename TInnerErrorCodeEnum, typename... Args>
+        static ResultWithReturnRef<TErrorCodeEnum, TResultType> lazy_failure(
+            const Result<TInnerErrorCodeEnum>& inner_error, TErrorCodeEnum error_code, LazyFormatString<Args...> format,
+            Args... args)
+        {
+            ResultWithReturnRef result(BaseResultCodes::FAILURE, inner_error, error_code, std::string_view(),
+                                       format.location());
+            result.deferred_message_ = DeferredMessage(format.text(), args...);
+            return (result);
         }
 
         TResultType& return_ref()
@@ -331,78 +1802,217 @@ namespace SEFUtility
     class ResultWithReturnUniquePtr : public Result<TErrorCodeEnum>
     {
        private:
-        ResultWithReturnUniquePtr(BaseResultCodes success_or_failure, TErrorCodeEnum error_code, const std::string& message)
-            : Result<TErrorCodeEnum>(success_or_failure, error_code, message)
+        ResultWithReturnUniquePtr(BaseResultCodes success_or_failure, TErrorCodeEnum error_code,
+                                  std::string_view message, std::source_location location = std::source_location())
+            : Result<TErrorCodeEnum>(success_or_failure, error_code, message, location)
         {
         }
 
         template <typename TInnerErrorCodeEnum>
         ResultWithReturnUniquePtr(BaseResultCodes success_or_failure, const Result<TInnerErrorCodeEnum>& inner_error,
-                                  TErrorCodeEnum error_code, const std::string& message)
-            : Result<TErrorCodeEnum>(success_or_failure, inner_error, error_code, message)
+                                  TErrorCodeEnum error_code, std::string_view message,
+                                  std::source_location location = std::source_location())
+            : Result<TErrorCodeEnum>(success_or_failure, inner_error, error_code, message, location)
+        {
+        }
+
+        ResultWithReturnUniquePtr(BaseResultCodes success_or_failure, TErrorCodeEnum error_code, StaticMessage message,
+                                  std::source_location location = std::source_location())
+            : Result<TErrorCodeEnum>(success_or_failure, error_code, message, location)
+        {
+        }
+
+        ResultWithReturnUniquePtr(BaseResultCodes success_or_failure, const ResultBase& inner_error,
+                                  TErrorCodeEnum error_code, StaticMessage message,
+                                  std::source_location location = std::source_location())
+            : Result<TErrorCodeEnum>(success_or_failure, inner_error, error_code, message, location)
         {
         }
 
        public:
         explicit ResultWithReturnUniquePtr(std::unique_ptr<TResultType>&& return_ptr)
-            : Result<TErrorCodeEnum>(BaseResultCodes::SUCCESS, TErrorCodeEnum::SUCCESS, "Success"),
+            : Result<TErrorCodeEnum>(BaseResultCodes::SUCCESS, TErrorCodeEnum::SUCCESS, StaticMessage("Success")),
               return_ptr_(std::move(return_ptr))
         {
         }
 
-        ResultWithReturnUniquePtr(ResultWithReturnUniquePtr<TErrorCodeEnum, TResultType>& result_to_copy)
-            : Result<TErrorCodeEnum>(result_to_copy.success_or_failure_, result_to_copy.error_code_, result_to_copy.message_),
-              return_ptr_(std::move(result_to_copy.return_ptr_))
+        //  Allocates the return value with make_unique, constructing it in place from the arguments.
+
+        template <typename... Args>
+        explicit ResultWithReturnUniquePtr(std::in_place_t, Args&&... args)
+            : Result<TErrorCodeEnum>(BaseResultCodes::SUCCESS, TErrorCodeEnum::SUCCESS, StaticMessage("Success")),
+              return_ptr_(std::make_unique<TResultType>(std::forward<Args>(args)...))
         {
-            this->inner_error_ = (result_to_copy.inner_error_ ? result_to_copy.inner_error_->shallow_copy() : nullptr);
         }
 
-        virtual ~ResultWithReturnUniquePtr(){};
+        //  Propagates a failure with the same error code type, taking over its message and inner error chain.
+
+        explicit ResultWithReturnUniquePtr(Result<TErrorCodeEnum>&& failure)
+            : Result<TErrorCodeEnum>(std::move(failure))
+        {
+            assert(this->failed());
+        }
+
+        ResultWithReturnUniquePtr(ResultWithReturnUniquePtr<TErrorCodeEnum, TResultType>& result_to_copy)
+            : Result<TErrorCodeEnum>(result_to_copy), return_ptr_(std::move(result_to_copy.return_ptr_))
+        {
+        }
 
-        operator const Result<TErrorCodeEnum>&() const
+        ResultWithReturnUniquePtr(ResultWithReturnUniquePtr<TErrorCodeEnum, TResultType>&& result_to_move) noexcept
+            : Result<TErrorCodeEnum>(std::move(result_to_move)), return_ptr_(std::move(result_to_move.return_ptr_))
         {
-            return (Result<TErrorCodeEnum>(this->success_or_failure_, this->error_code_, this->message_));
         }
 
+        virtual ~ResultWithReturnUniquePtr(){};
+
         const ResultWithReturnUniquePtr<TErrorCodeEnum, TResultType>& operator=(
                 const ResultWithReturnUniquePtr<TErrorCodeEnum, TResultType>& result_to_copy) = delete;
 
+        const ResultWithReturnUniquePtr<TErrorCodeEnum, TResultType>& operator=(
+            ResultWithReturnUniquePtr<TErrorCodeEnum, TResultType>&& result_to_move) noexcept
+        {
+            return_ptr_ = std::move(result_to_move.return_ptr_);
+            Result<TErrorCodeEnum>::operator=(std::move(result_to_move));
+
+            return (*this);
+        }
+
         static ResultWithReturnUniquePtr<TErrorCodeEnum, TResultType> success(std::unique_ptr<TResultType>&& return_value)
         {
             return (ResultWithReturnUniquePtr(std::move(return_value)));
         }
 
+        template <typename... Args>
+        static ResultWithReturnUniquePtr<TErrorCodeEnum, TResultType> success(std::in_place_t, Args&&... args)
+        {
+            return (ResultWithReturnUniquePtr(std::in_place, std::forward<Args>(args)...));
+        }
+
         static ResultWithReturnUniquePtr<TErrorCodeEnum, TResultType> failure(TErrorCodeEnum error_code,
-                                                                              const std::string& message)
+                                                                              LocatedMessage message)
         {
-            return (ResultWithReturnUniquePtr(BaseResultCodes::FAILURE, error_code, message));
+            return (ResultWithReturnUniquePtr(BaseResultCodes::FAILURE, error_code, message.text(),
+                                              message.location()));
         }
 
         template <typename... Args>
         static ResultWithReturnUniquePtr<TErrorCodeEnum, TResultType> failure(TErrorCodeEnum error_code,
-                                                                              const std::string& format, Args... args)
+                                                                              LocatedMessage format, Args... args)
         {
-            return (ResultWithReturnUniquePtr(BaseResultCodes::FAILURE, error_code, fmt::format(format, args...)));
+            return (ResultWithReturnUniquePtr(BaseResultCodes::FAILURE, error_code,
+                                              FormattedMessage(format.text(), args...), format.location()));
         }
 
         template <typename TInnerErrorCodeEnum>
         static ResultWithReturnUniquePtr<TErrorCodeEnum, TResultType> failure(
-            const Result<TInnerErrorCodeEnum>& inner_error, TErrorCodeEnum error_code, const std::string& message)
+            const Result<TInnerErrorCodeEnum>& inner_error, TErrorCodeEnum error_code, LocatedMessage message)
         {
-            return (ResultWithReturnUniquePtr(BaseResultCodes::FAILURE, inner_error, error_code, message));
+            return (ResultWithReturnUniquePtr(BaseResultCodes::FAILURE, inner_error, error_code, message.text(),
+                                              message.location()));
         }
 
         template <typename TInnerErrorCodeEnum, typename... Args>
         static ResultWithReturnUniquePtr<TErrorCodeEnum, TResultType> failure(
-            const Result<TInnerErrorCodeEnum>& inner_error, TErrorCodeEnum error_code, const std::string& format,
+            const Result<TInnerErrorCodeEnum>& inner_error, TErrorCodeEnum error_code, LocatedMessage format,
             Args... args)
         {
             return (ResultWithReturnUniquePtr(BaseResultCodes::FAILURE, inner_error, error_code,
-                                              fmt::format(format, args...)));
+                                              FormattedMessage(format.text(), args...), format.location()));
+        }
+
+        static ResultWithReturnUniquePtr<TErrorCodeEnum, TResultType> failure(
+            TErrorCodeEnum error_code, StaticMessage message,
+            std::source_location location = std::source_location::current())
+        {
+            return (ResultWithReturnUniquePtr(BaseResultCodes::FAILURE, error_code, message, location));
+        }
+
+        static ResultWithReturnUniquePtr<TErrorCodeEnum, TResultType> failure(
+            const ResultBase& inner_error, TErrorCodeEnum error_code, StaticMessage message,
+            std::source_location location = std::source_location::current())
+        {
+            return (ResultWithReturnUniquePtr(BaseResultCodes::FAILURE, inner_error, error_code, message, location));
+        }
+
+        template <typename... Args>
+        static ResultWithReturnUniquePtr<TErrorCodeEnum, TResultType> lazy_failure(
+            TErrorCodeEnum error_code, LazyFormatString<Args...> format, Args... args)
+        {
+            ResultWithReturnUniquePtr result(BaseResultCodes::FAILURE, error_code, std::string_view(),
+                                             format.location());
+            result.deferred_message_ = DeferredMessage(format.text(), args...);
+            return (result);
+        }
+
+        template <typename TInnerErrorCodeEnum, typename... Args>
+        static ResultWithReturnUniquePtr<TErrorCodeEnum, TResultType> lazy_failure(
+            const Result<TInnerErrorCodeEnum>& inner_error, TErrorCodeEnum error_code, LazyFormatString<Args...> format,
+            Args... args)
+        {
+            ResultWithReturnUniquePtr result(BaseResultCodes::FAILURE, inner_error, error_code, std::string_view(),
+                                             format.location());
+            result.deferred_message_ = DeferredMessage(format.text(), args...);
+            return (result);
         }
 
         std::unique_ptr<TResultType>& return_ptr() { return (return_ptr_); }
 
+        //  Monadic operations named after those of std::expected.  On an rvalue the payload is moved into the
+        //      continuation and a failure is moved into the Result returned, so no step copies either.
+
+        template <typename TFunction>
+        auto and_then(TFunction&& function) &
+        {
+            auto payload = [this]() -> std::unique_ptr<TResultType>& { return (return_ptr_); };
+
+            return (this->and_then_impl(*this, std::forward<TFunction>(function), payload));
+        }
+
+        template <typename TFunction>
+        auto and_then(TFunction&& function) &&
+        {
+            auto payload = [this]() -> std::unique_ptr<TResultType>&& { return (std::move(return_ptr_)); };
+
+            return (this->and_then_impl(std::move(*this), std::forward<TFunction>(function), payload));
+        }
+
+        template <typename TFunction>
+        auto transform(TFunction&& function) &
+        {
+            auto payload = [this]() -> std::unique_ptr<TResultType>& { return (return_ptr_); };
+
+            return (this->transform_impl(*this, std::forward<TFunction>(function), payload));
+        }
+
+        template <typename TFunction>
+        auto transform(TFunction&& function) &&
+        {
+            auto payload = [this]() -> std::unique_ptr<TResultType>&& { return (std::move(return_ptr_)); };
+
+            return (this->transform_impl(std::move(*this), std::forward<TFunction>(function), payload));
+        }
+
+        template <typename TFunction>
+        auto or_else(TFunction&& function) &
+        {
+            auto payload = [this]() -> std::unique_ptr<TResultType>& { return (return_ptr_); };
+
+            return (this->or_else_impl(*this, std::forward<TFunction>(function), payload));
+        }
+
+        template <typename TFunction>
+        auto or_else(TFunction&& function) &&
+        {
+            auto payload = [this]() -> std::unique_ptr<TResultType>&& { return (std::move(return_ptr_)); };
+
+            return (this->or_else_impl(std::move(*this), std::forward<TFunction>(function), payload));
+        }
+
+        std::unique_ptr<TResultType> value_or(std::unique_ptr<TResultType> default_value) &&
+        {
+            return (this->failed() ? std::move(default_value) : std::move(return_ptr_));
+        }
+
        private:
         std::unique_ptr<TResultType> return_ptr_;
     };
@@ -411,48 +2021,80 @@ namespace SEFUtility
     class ResultWithReturnSharedPtr : public Result<TErrorCodeEnum>
     {
        private:
-        ResultWithReturnSharedPtr(BaseResultCodes success_or_failure, TErrorCodeEnum error_code, const std::string& message)
-            : Result<TErrorCodeEnum>(success_or_failure, error_code, message)
+        ResultWithReturnSharedPtr(BaseResultCodes success_or_failure, TErrorCodeEnum error_code,
+                                  std::string_view message, std::source_location location = std::source_location())
+            : Result<TErrorCodeEnum>(success_or_failure, error_code, message, location)
         {
         }
 
         template <typename TInnerErrorCodeEnum>
         ResultWithReturnSharedPtr(BaseResultCodes success_or_failure, const Result<TInnerErrorCodeEnum>& inner_error,
-                                  TErrorCodeEnum error_code, const std::string& message)
-            : Result<TErrorCodeEnum>(success_or_failure, inner_error, error_code, message)
+                                  TErrorCodeEnum error_code, std::string_view message,
+                                  std::source_location location = std::source_location())
+            : Result<TErrorCodeEnum>(success_or_failure, inner_error, error_code, message, location)
+        {
+        }
+
+        ResultWithReturnSharedPtr(BaseResultCodes success_or_failure, TErrorCodeEnum error_code, StaticMessage message,
+                                  std::source_location location = std::source_location())
+            : Result<TErrorCodeEnum>(success_or_failure, error_code, message, location)
+        {
+        }
+
+        ResultWithReturnSharedPtr(BaseResultCodes success_or_failure, const ResultBase& inner_error,
+                                  TErrorCodeEnum error_code, StaticMessage message,
+                                  std::source_location location = std::source_location())
+            : Result<TErrorCodeEnum>(success_or_failure, inner_error, error_code, message, location)
         {
         }
 
        public:
         ResultWithReturnSharedPtr(std::shared_ptr<TResultType>& return_ptr)
-            : Result<TErrorCodeEnum>(BaseResultCodes::SUCCESS, TErrorCodeEnum::SUCCESS, "Success"),
+            : Result<TErrorCodeEnum>(BaseResultCodes::SUCCESS, TErrorCodeEnum::SUCCESS, StaticMessage("Success")),
               return_ptr_(return_ptr)
         {
         }
 
-        ResultWithReturnSharedPtr(const ResultWithReturnSharedPtr<TErrorCodeEnum, TResultType>& result_to_copy)
-            : Result<TErrorCodeEnum>(result_to_copy.success_or_failure_, result_to_copy.error_code_, result_to_copy.message_),
-              return_ptr_(result_to_copy.return_ptr_)
+        ResultWithReturnSharedPtr(std::shared_ptr<TResultType>&& return_ptr)
+            : Result<TErrorCodeEnum>(BaseResultCodes::SUCCESS, TErrorCodeEnum::SUCCESS, StaticMessage("Success")),
+              return_ptr_(std::move(return_ptr))
         {
-            this->inner_error_ = (result_to_copy.inner_error_ ? result_to_copy.inner_error_->shallow_copy() : nullptr);
         }
 
-        virtual ~ResultWithReturnSharedPtr(){};
+        //  Propagates a failure with the same error code type, taking over its message and inner error chain.
 
-        operator const Result<TErrorCodeEnum>&() const
+        explicit ResultWithReturnSharedPtr(Result<TErrorCodeEnum>&& failure)
+            : Result<TErrorCodeEnum>(std::move(failure))
         {
-            return (Result<TErrorCodeEnum>(this->success_or_failure_, this->error_code_, this->message_));
+            assert(this->failed());
         }
 
+        ResultWithReturnSharedPtr(const ResultWithReturnSharedPtr<TErrorCodeEnum, TResultType>& result_to_copy)
+            : Result<TErrorCodeEnum>(result_to_copy), return_ptr_(result_to_copy.return_ptr_)
+        {
+        }
+
+        ResultWithReturnSharedPtr(ResultWithReturnSharedPtr<TErrorCodeEnum, TResultType>&& result_to_move) noexcept
+            : Result<TErrorCodeEnum>(std::move(result_to_move)), return_ptr_(std::move(result_to_move.return_ptr_))
+        {
+        }
+
+        virtual ~ResultWithReturnSharedPtr(){};
+
         const ResultWithReturnSharedPtr<TErrorCodeEnum, TResultType>& operator=(
             const ResultWithReturnSharedPtr<TErrorCodeEnum, TResultType>& result_to_copy)
         {
-            ResultBase::success_or_failure_ = result_to_copy.success_or_failure_;
-            ResultBase::message_ = result_to_copy.message_;
-            Result<TErrorCodeEnum>::error_code_ = result_to_copy.error_code_;
+            Result<TErrorCodeEnum>::operator=(result_to_copy);
             return_ptr_ = result_to_copy.return_ptr_;
 
-            this->inner_error_ = (result_to_copy.inner_error_ ? result_to_copy.inner_error_->shallow_copy() : nullptr);
+            return (*this);
+        }
+
+        const ResultWithReturnSharedPtr<TErrorCodeEnum, TResultType>& operator=(
+            ResultWithReturnSharedPtr<TErrorCodeEnum, TResultType>&& result_to_move) noexcept
+        {
+            return_ptr_ = std::move(result_to_move.return_ptr_);
+            Result<TErrorCodeEnum>::operator=(std::move(result_to_move));
 
             return (*this);
         }
@@ -461,38 +2103,299 @@ namespace SEFUtility
             std::shared_ptr<TResultType>& return_value) = delete;
 
         static ResultWithReturnSharedPtr<TErrorCodeEnum, TResultType> failure(TErrorCodeEnum error_code,
-                                                                              const std::string& message)
+                                                                              LocatedMessage message)
         {
-            return (ResultWithReturnSharedPtr(BaseResultCodes::FAILURE, error_code, message));
+            return (ResultWithReturnSharedPtr(BaseResultCodes::FAILURE, error_code, message.text(),
+                                              message.location()));
         }
 
         template <typename... Args>
         static ResultWithReturnSharedPtr<TErrorCodeEnum, TResultType> failure(TErrorCodeEnum error_code,
-                                                                              const std::string& format, Args... args)
+                                                                              LocatedMessage format, Args... args)
         {
-            return (ResultWithReturnSharedPtr(BaseResultCodes::FAILURE, error_code, fmt::format(format, args...)));
+            return (ResultWithReturnSharedPtr(BaseResultCodes::FAILURE, error_code,
+                                              FormattedMessage(format.text(), args...), format.location()));
         }
 
         template <typename TInnerErrorCodeEnum>
         static ResultWithReturnSharedPtr<TErrorCodeEnum, TResultType> failure(
-            const Result<TInnerErrorCodeEnum>& inner_error, TErrorCodeEnum error_code, const std::string& message)
+            const Result<TInnerErrorCodeEnum>& inner_error, TErrorCodeEnum error_code, LocatedMessage message)
         {
-            return (ResultWithReturnSharedPtr(BaseResultCodes::FAILURE, inner_error, error_code, message));
+            return (ResultWithReturnSharedPtr(BaseResultCodes::FAILURE, inner_error, error_code, message.text(),
+                                              message.location()));
         }
 
         template <typename TInnerErrorCodeEnum, typename... Args>
         static ResultWithReturnSharedPtr<TErrorCodeEnum, TResultType> failure(
-            const Result<TInnerErrorCodeEnum>& inner_error, TErrorCodeEnum error_code, const std::string& format,
+            const Result<TInnerErrorCodeEnum>& inner_error, TErrorCodeEnum error_code, LocatedMessage format,
             Args... args)
         {
             return (ResultWithReturnSharedPtr(BaseResultCodes::FAILURE, inner_error, error_code,
-                                              fmt::format(format, args...)));
+                                              FormattedMessage(format.text(), args...), format.location()));
+        }
+
+        static ResultWithReturnSharedPtr<TErrorCodeEnum, TResultType> failure(
+            TErrorCodeEnum error_code, StaticMessage message,
+            std::source_location location = std::source_location::current())
+        {
+            return (ResultWithReturnSharedPtr(BaseResultCodes::FAILURE, error_code, message, location));
+        }
+
+        static ResultWithReturnSharedPtr<TErrorCodeEnum, TResultType> failure(
+            const ResultBase& inner_error, TErrorCodeEnum error_code, StaticMessage message,
+            std::source_location location = std::source_location::current())
+        {
+            return (ResultWithReturnSharedPtr(BaseResultCodes::FAILURE, inner_error, error_code, message, location));
+        }
+
+        template <typename... Args>
+        static ResultWithReturnSharedPtr<TErrorCodeEnum, TResultType> lazy_failure(
+            TErrorCodeEnum error_code, LazyFormatString<Args...> format, Args... args)
+        {
+            ResultWithReturnSharedPtr result(BaseResultCodes::FAILURE, error_code, std::string_view(),
+                                             format.location());
+            result.deferred_message_ = DeferredMessage(format.text(), args...);
+            return (result);
+        }
+
+        template <typename TInnerErrorCodeEnum, typename... Args>
+        static ResultWithReturnSharedPtr<TErrorCodeEnum, TResultType> lazy_failure(
+            const Result<TInnerErrorCodeEnum>& inner_error, TErrorCodeEnum error_code, LazyFormatString<Args...> format,
+            Args... args)
+        {
+            ResultWithReturnSharedPtr result(BaseResultCodes::FAILURE, inner_error, error_code, std::string_view(),
+                                             format.location());
+            result.deferred_message_ = DeferredMessage(format.text(), args...);
+            return (result);
         }
 
         std::shared_ptr<TResultType>& return_ptr() { return (return_ptr_); }
 
+        //  Monadic operations named after those of std::expected.  On an rvalue the payload is moved into the
+        //      continuation and a failure is moved into the Result returned, so no step copies either.
+
+        template <typename TFunction>
+        auto and_then(TFunction&& function) &
+        {
+            auto payload = [this]() -> std::shared_ptr<TResultType>& { return (return_ptr_); };
+
+            return (this->and_then_impl(*this, std::forward<TFunction>(function), payload));
+        }
+
+        template <typename TFunction>
+        auto and_then(TFunction&& function) &&
+        {
+            auto payload = [this]() -> std::shared_ptr<TResultType>&& { return (std::move(return_ptr_)); };
+
+            return (this->and_then_impl(std::move(*this), std::forward<TFunction>(function), payload));
+        }
+
+        template <typename TFunction>
+        auto transform(TFunction&& function) &
+        {
+            auto payload = [this]() -> std::shared_ptr<TResultType>& { return (return_ptr_); };
+
+            return (this->transform_impl(*this, std::forward<TFunction>(function), payload));
+        }
+
+        template <typename TFunction>
+        auto transform(TFunction&& function) &&
+        {
+            auto payload = [this]() -> std::shared_ptr<TResultType>&& { return (std::move(return_ptr_)); };
+
+            return (this->transform_impl(std::move(*this), std::forward<TFunction>(function), payload));
+        }
+
+        template <typename TFunction>
+        auto or_else(TFunction&& function) &
+        {
+            auto payload = [this]() -> std::shared_ptr<TResultType>& { return (return_ptr_); };
+
+            return (this->or_else_impl(*this, std::forward<TFunction>(function), payload));
+        }
+
+        template <typename TFunction>
+        auto or_else(TFunction&& function) &&
+        {
+            auto payload = [this]() -> std::shared_ptr<TResultType>&& { return (std::move(return_ptr_)); };
+
+            return (this->or_else_impl(std::move(*this), std::forward<TFunction>(function), payload));
+        }
+
+        std::shared_ptr<TResultType> value_or(std::shared_ptr<TResultType> default_value) const&
+        {
+            return (this->failed() ? std::move(default_value) : return_ptr_);
+        }
+
+        std::shared_ptr<TResultType> value_or(std::shared_ptr<TResultType> default_value) &&
+        {
+            return (this->failed() ? std::move(default_value) : std::move(return_ptr_));
+        }
+
        private:
         std::shared_ptr<TResultType> return_ptr_;
     };
 
-}  // namespace SEFUtility
\ No newline at end of file
+    //
+    //  Renders a result and its inner error chain straight into an output iterator, fmt::formatter below uses
+    //      it so Results may be passed to fmt::format() and fmt::format_to() directly.  The compact form is one
+    //      line, 'CODE: message <- INNER_CODE: inner message', the verbose form puts each node of the chain on
+    //      its own line with the enum name, code value and source location, followed by the node's backtrace
+    //      when one was captured.  Nodes beyond the depth limit are counted rather than rendered.
+    //
+
+    struct ResultFormatOptions
+    {
+        bool verbose = false;
+
+        std::size_t max_depth = SIZE_MAX;
+    };
+
+    template <typename TOutputIterator>
+    TOutputIterator format_result(TOutputIterator output, const ResultBase& result,
+                                  ResultFormatOptions options = ResultFormatOptions())
+    {
+        //  fmt appends to contiguous containers, its own buffers included, in one call rather than a character at
+        //      a time.
+
+        auto write = [&output](std::string_view text) { output = fmt::format_to(output, "{}", text); };
+
+        std::size_t depth = 0;
+        const ResultBase* node = &result;
+
+        for (; (node != nullptr) && (depth < options.max_depth); node = node->inner_error().get(), depth++)
+        {
+            if (depth > 0)
+            {
+                write(options.verbose ? "  caused by " : " <- ");
+            }
+
+            fmt::format_int value(node->error_code_value());
+
+            if (node->error_code_name().empty())
+            {
+                write(std::string_view(value.data(), value.size()));
+            }
+            else
+            {
+                write(node->error_code_name());
+            }
+
+            if (options.verbose)
+            {
+                write(" (");
+                write(node->error_code_enum_name());
+                write(" ");
+                write(std::string_view(value.data(), value.size()));
+                write(")");
+
+                if (node->location().line() != 0)
+                {
+                    fmt::format_int line(node->location().line());
+
+                    write(" at ");
+                    write(node->location().file_name());
+                    write(":");
+                    write(std::string_view(line.data(), line.size()));
+                }
+            }
+
+            if (node->failed())
+            {
+                write(": ");
+                write(node->message());
+            }
+
+            //  Only the first cause of a failure with several is followed, the others are counted.
+
+            if (node->causes().size() > 1)
+            {
+                fmt::format_int others(node->causes().size() - 1);
+
+                write(" (+");
+                write(std::string_view(others.data(), others.size()));
+                write(" more causes)");
+            }
+
+            if (options.verbose)
+            {
+                write("\n");
+
+                if (node->backtrace())
+                {
+                    write(node->backtrace()->symbolize());
+                }
+            }
+        }
+
+        if (node != nullptr)
+        {
+            std::size_t remaining = 0;
+
+            for (; node != nullptr; node = node->inner_error().get())
+            {
+                remaining++;
+            }
+
+            fmt::format_int count(remaining);
+
+            write(depth == 0 ? "... " : (options.verbose ? "  ... " : " <- ... "));
+            write(std::string_view(count.data(), count.size()));
+            write(options.verbose ? " more\n" : " more");
+        }
+
+        return (output);
+    }
+}  // namespace SEFUtility
+
+//
+//  Format spec for Results is any of 'c' for the compact form (the default), 'v' for the verbose form and a
+//      depth limit, for example fmt::format("{:v2}", result).
+//
+
+template <typename TResult>
+struct fmt::formatter<TResult, char, std::enable_if_t<std::is_base_of_v<SEFUtility::ResultBase, TResult>>>
+{
+    SEFUtility::ResultFormatOptions options_;
+
+    constexpr auto parse(format_parse_context& context) -> decltype(context.begin())
+    {
+        auto position = context.begin();
+        bool has_depth = false;
+        std::size_t depth = 0;
+
+        for (; (position != context.end()) && (*position != '}'); ++position)
+        {
+            if (*position == 'c')
+            {
+                options_.verbose = false;
+            }
+            else if (*position == 'v')
+            {
+                options_.verbose = true;
+            }
+            else if ((*position >= '0') && (*position <= '9'))
+            {
+                has_depth = true;
+                depth = (depth * 10) + std::size_t(*position - '0');
+            }
+            else
+            {
+                throw format_error("invalid format specifier for Result");
+            }
+        }
+
+        if (has_depth)
+        {
+            options_.max_depth = depth;
+        }
+
+        return (position);
+    }
+
+    template <typename TFormatContext>
+    auto format(const TResult& result, TFormatContext& context) const -> decltype(context.out())
+    {
+        return (SEFUtility::format_result(context.out(), result, options_));
+    }
+};
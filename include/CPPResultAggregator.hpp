@@ -0,0 +1,200 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#include "CPPResult.hpp"
+
+//
+//  Collecting the Results of work fanned out over many threads without a lock.  Successes never touch shared
+//      state, each failure costs one atomic operation on a cache line of its own plus, for failures which are
+//      kept, the shallow copy of the failure into a chain node.  Kept failures are immutable chain nodes, so
+//      they may be read while other threads are still offering results and remain valid after the aggregator
+//      is destroyed for as long as a Result built from them refers to them.
+//
+
+namespace SEFUtility
+{
+    //
+    //  Keeps the first failure offered, later failures are only counted.  Workers may poll failed() to stop
+    //      early once any of them has failed.
+    //
+
+    class FirstFailureLatch
+    {
+       public:
+        static constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+        FirstFailureLatch() = default;
+
+        FirstFailureLatch(const FirstFailureLatch&) = delete;
+        FirstFailureLatch& operator=(const FirstFailureLatch&) = delete;
+
+        ~FirstFailureLatch() { InnerErrorPtr::adopt(first_failure_.load(std::memory_order_acquire)); }
+
+        //  Returns true if the result is the failure kept by the latch.
+
+        bool offer(const ResultBase& result)
+        {
+            if (result.succeeded())
+            {
+                return (false);
+            }
+
+            failure_count_.fetch_add(1, std::memory_order_relaxed);
+
+            if (first_failure_.load(std::memory_order_relaxed) != nullptr)
+            {
+                return (false);
+            }
+
+            InnerErrorPtr node = result.as_inner_error();
+            const ResultBase* expected = nullptr;
+
+            if (first_failure_.compare_exchange_strong(expected, node.get(), std::memory_order_acq_rel,
+                                                       std::memory_order_relaxed))
+            {
+                node.release();
+                return (true);
+            }
+
+            return (false);
+        }
+
+        bool failed() const { return (first_failure_.load(std::memory_order_acquire) != nullptr); }
+
+        const ResultBase* first_failure() const { return (first_failure_.load(std::memory_order_acquire)); }
+
+        std::size_t failure_count() const { return (failure_count_.load(std::memory_order_relaxed)); }
+
+        //  A success if nothing failed, otherwise a failure with the first failure as its inner error.
+
+        template <typename TErrorCodeEnum>
+        Result<TErrorCodeEnum> reduce(TErrorCodeEnum error_code, LocatedMessage message) const
+        {
+            const ResultBase* first_failure = this->first_failure();
+
+            if (first_failure == nullptr)
+            {
+                return (Result<TErrorCodeEnum>::success());
+            }
+
+            return (Result<TErrorCodeEnum>::failure(*first_failure, error_code, message));
+        }
+
+       private:
+        alignas(CACHE_LINE_SIZE) std::atomic<const ResultBase*> first_failure_{nullptr};
+
+        std::atomic<std::size_t> failure_count_{0};
+    };
+
+    //
+    //  Keeps up to a fixed number of failures in the order they claimed a slot, failures beyond the capacity
+    //      are only counted.  Claiming a slot is a single fetch_add, so offering never waits on another thread.
+    //
+
+    class FailureCollector
+    {
+       public:
+        static constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+        explicit FailureCollector(std::size_t capacity)
+            : capacity_(capacity), slots_(std::make_unique<std::atomic<const ResultBase*>[]>(capacity))
+        {
+            for (std::size_t i = 0; i < capacity_; i++)
+            {
+                slots_[i].store(nullptr, std::memory_order_relaxed);
+            }
+        }
+
+        FailureCollector(const FailureCollector&) = delete;
+        FailureCollector& operator=(const FailureCollector&) = delete;
+
+        ~FailureCollector()
+        {
+            for (std::size_t i = 0; i < capacity_; i++)
+            {
+                InnerErrorPtr::adopt(slots_[i].load(std::memory_order_acquire));
+            }
+        }
+
+        //  Returns true if the result is a failure which was kept.
+
+        bool offer(const ResultBase& result)
+        {
+            if (result.succeeded())
+            {
+                return (false);
+            }
+
+            std::size_t slot = failure_count_.fetch_add(1, std::memory_order_relaxed);
+
+            if (slot >= capacity_)
+            {
+                return (false);
+            }
+
+            slots_[slot].store(result.as_inner_error().release(), std::memory_order_release);
+
+            return (true);
+        }
+
+        std::size_t capacity() const { return (capacity_); }
+
+        //  Every failure offered, including those beyond the capacity.
+
+        std::size_t failure_count() const { return (failure_count_.load(std::memory_order_relaxed)); }
+
+        bool failed() const { return (failure_count() != 0); }
+
+        //  The failures kept so far.  A failure whose slot was claimed but not yet filled by a thread still
+        //      inside offer() is not included.
+
+        std::vector<InnerErrorPtr> failures() const
+        {
+            std::vector<InnerErrorPtr> kept;
+            std::size_t claimed = std::min(failure_count(), capacity_);
+
+            kept.reserve(claimed);
+
+            for (std::size_t i = 0; i < claimed; i++)
+            {
+                const ResultBase* failure = slots_[i].load(std::memory_order_acquire);
+
+                if (failure != nullptr)
+                {
+                    kept.emplace_back(failure);
+                }
+            }
+
+            return (kept);
+        }
+
+        //  A success if nothing failed, otherwise a failure whose causes are the failures kept, the first of them
+        //      being its inner error.  Call once every worker has returned from offer().
+
+        template <typename TErrorCodeEnum>
+        Result<TErrorCodeEnum> reduce(TErrorCodeEnum error_code, LocatedMessage message) const
+        {
+            std::vector<InnerErrorPtr> kept = failures();
+
+            if (kept.empty())
+            {
+                return (Result<TErrorCodeEnum>::success());
+            }
+
+            return (Result<TErrorCodeEnum>::failure(kept, error_code, message));
+        }
+
+       private:
+        const std::size_t capacity_;
+
+        std::unique_ptr<std::atomic<const ResultBase*>[]> slots_;
+
+        alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> failure_count_{0};
+    };
+}  // namespace SEFUtility
@@ -0,0 +1,187 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <utility>
+#include <span>
+#include <string>
+
+#include "CPPResultMemory.hpp"
+
+#if __has_include(<execinfo.h>)
+#include <execinfo.h>
+#define CPPRESULT_HAS_EXECINFO
+#endif
+
+//
+//  Sampled backtraces for failures.  Capturing records only the raw return addresses of the failing thread's
+//      stack, symbolization is deferred until the backtrace is formatted.  Capture is off by default, setting
+//      a sampling interval of N captures the backtrace of every Nth failure created on each thread, so the
+//      cost of unwinding can be bounded in production.  Backtraces are not available on platforms without
+//      <execinfo.h>.
+//
+
+namespace SEFUtility
+{
+    class FailureBacktrace;
+
+    //  Backtraces are immutable and shared by every copy of the failure they were captured for.
+
+    class FailureBacktracePtr
+    {
+       public:
+        FailureBacktracePtr() = default;
+
+        FailureBacktracePtr(std::nullptr_t) {}
+
+        explicit FailureBacktracePtr(const FailureBacktrace* backtrace);
+
+        FailureBacktracePtr(const FailureBacktracePtr& ptr_to_copy);
+
+        FailureBacktracePtr(FailureBacktracePtr&& ptr_to_move) noexcept
+            : backtrace_(std::exchange(ptr_to_move.backtrace_, nullptr))
+        {
+        }
+
+        ~FailureBacktracePtr();
+
+        FailureBacktracePtr& operator=(FailureBacktracePtr ptr_to_assign) noexcept
+        {
+            std::swap(backtrace_, ptr_to_assign.backtrace_);
+
+            return (*this);
+        }
+
+        const FailureBacktrace* get() const { return (backtrace_); }
+
+        const FailureBacktrace& operator*() const { return (*backtrace_); }
+
+        const FailureBacktrace* operator->() const { return (backtrace_); }
+
+        explicit operator bool() const { return (backtrace_ != nullptr); }
+
+       private:
+        const FailureBacktrace* backtrace_ = nullptr;
+    };
+
+    class FailureBacktrace
+    {
+       public:
+        static constexpr std::size_t MAX_FRAMES = 32;
+
+        FailureBacktrace(const FailureBacktrace&) = delete;
+        FailureBacktrace& operator=(const FailureBacktrace&) = delete;
+
+        static void* operator new(std::size_t size) { return (allocate_result_block(size)); }
+
+        static void operator delete(void* backtrace, std::size_t size) { deallocate_result_block(backtrace, size); }
+
+        //  Zero disables capture, which is the default.  The interval applies to all threads.
+
+        static void set_sampling_interval(unsigned int interval)
+        {
+            sampling_interval().store(interval, std::memory_order_relaxed);
+        }
+
+        static unsigned int get_sampling_interval() { return (sampling_interval().load(std::memory_order_relaxed)); }
+
+        //  Called for each failure, returns a backtrace for one in every sampling interval failures on this thread
+        //      and null for the rest.
+
+        static FailureBacktracePtr sample()
+        {
+            unsigned int interval = sampling_interval().load(std::memory_order_relaxed);
+
+            if (interval == 0)
+            {
+                return (nullptr);
+            }
+
+            thread_local unsigned int failures_since_capture = 0;
+
+            if (++failures_since_capture < interval)
+            {
+                return (nullptr);
+            }
+
+            failures_since_capture = 0;
+
+            return (capture());
+        }
+
+        static FailureBacktracePtr capture()
+        {
+#if defined(CPPRESULT_HAS_EXECINFO)
+            FailureBacktrace* backtrace = new FailureBacktrace();
+
+            backtrace->frame_count_ = ::backtrace(backtrace->frames_, MAX_FRAMES);
+
+            return (FailureBacktracePtr(backtrace));
+#else
+            return (nullptr);
+#endif
+        }
+
+        std::span<void* const> frames() const { return (std::span<void* const>(frames_, frame_count_)); }
+
+        //  One line per frame, symbolized as far as the platform allows.
+
+        std::string symbolize() const
+        {
+            std::string text;
+
+#if defined(CPPRESULT_HAS_EXECINFO)
+            char** symbols = ::backtrace_symbols(frames_, frame_count_);
+
+            for (int i = 0; i < frame_count_; i++)
+            {
+                text.append("#").append(std::to_string(i)).append(" ");
+                text.append(symbols != nullptr ? symbols[i] : "?").append("\n");
+            }
+
+            std::free(symbols);
+#endif
+            return (text);
+        }
+
+       private:
+        friend class FailureBacktracePtr;
+
+        FailureBacktrace() = default;
+
+        static std::atomic<unsigned int>& sampling_interval()
+        {
+            static std::atomic<unsigned int> interval{0};
+
+            return (interval);
+        }
+
+        mutable std::atomic<unsigned int> reference_count_{0};
+
+        int frame_count_ = 0;
+
+        void* frames_[MAX_FRAMES];
+    };
+
+    inline FailureBacktracePtr::FailureBacktracePtr(const FailureBacktrace* backtrace) : backtrace_(backtrace)
+    {
+        if (backtrace_ != nullptr)
+        {
+            backtrace_->reference_count_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    inline FailureBacktracePtr::FailureBacktracePtr(const FailureBacktracePtr& ptr_to_copy)
+        : FailureBacktracePtr(ptr_to_copy.backtrace_)
+    {
+    }
+
+    inline FailureBacktracePtr::~FailureBacktracePtr()
+    {
+        if ((backtrace_ != nullptr) && (backtrace_->reference_count_.fetch_sub(1, std::memory_order_acq_rel) == 1))
+        {
+            delete backtrace_;
+        }
+    }
+}  // namespace SEFUtility
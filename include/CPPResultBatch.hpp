@@ -0,0 +1,514 @@
+#pragma once
+
+#include <algorithm>
+#include <assert.h>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <ranges>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "CPPErrorCodeKernels.hpp"
+#include "CPPResult.hpp"
+
+//
+//  Outcomes of a batch of operations stored struct-of-arrays style rather than as a vector of Results.  Every
+//      entry starts as a success and a batch with no failures holds nothing but its size.  The first failure
+//      allocates a failure bitmap and a packed error code array covering the whole batch, the message and inner
+//      error of each failure live in a side table ordered by index, so all storage beyond the two dense arrays
+//      is proportional to the number of failures.  Storage comes from the result memory resource.
+//
+
+namespace SEFUtility
+{
+    template <typename TErrorCodeEnum>
+    class ResultBatch
+    {
+       public:
+        typedef TErrorCodeEnum ErrorCodeType;
+        typedef std::underlying_type_t<TErrorCodeEnum> ErrorCodeValueType;
+
+        static constexpr std::size_t BITS_PER_WORD = 64;
+
+        explicit ResultBatch(std::size_t size)
+            : size_(size),
+              failure_bits_(result_memory_resource()),
+              error_codes_(result_memory_resource()),
+              failures_(result_memory_resource())
+        {
+        }
+
+        ResultBatch(const ResultBatch<TErrorCodeEnum>& batch_to_copy)
+            : size_(batch_to_copy.size_),
+              failure_count_(batch_to_copy.failure_count_),
+              failure_bits_(batch_to_copy.failure_bits_, result_memory_resource()),
+              error_codes_(batch_to_copy.error_codes_, result_memory_resource()),
+              failures_(batch_to_copy.failures_, result_memory_resource())
+        {
+        }
+
+        ResultBatch(ResultBatch<TErrorCodeEnum>&& batch_to_move) noexcept
+            : size_(std::exchange(batch_to_move.size_, 0)),
+              failure_count_(std::exchange(batch_to_move.failure_count_, 0)),
+              failure_bits_(std::move(batch_to_move.failure_bits_)),
+              error_codes_(std::move(batch_to_move.error_codes_)),
+              failures_(std::move(batch_to_move.failures_))
+        {
+        }
+
+        const ResultBatch<TErrorCodeEnum>& operator=(const ResultBatch<TErrorCodeEnum>& batch_to_copy)
+        {
+            size_ = batch_to_copy.size_;
+            failure_count_ = batch_to_copy.failure_count_;
+            failure_bits_ = batch_to_copy.failure_bits_;
+            error_codes_ = batch_to_copy.error_codes_;
+            failures_ = batch_to_copy.failures_;
+
+            return (*this);
+        }
+
+        //  A moved-from batch is left empty, see move_storage() for batches allocated from different resources.
+
+        const ResultBatch<TErrorCodeEnum>& operator=(ResultBatch<TErrorCodeEnum>&& batch_to_move) noexcept
+        {
+            if (this == &batch_to_move)
+            {
+                return (*this);
+            }
+
+            size_ = std::exchange(batch_to_move.size_, 0);
+            failure_count_ = std::exchange(batch_to_move.failure_count_, 0);
+            move_storage(failure_bits_, batch_to_move.failure_bits_);
+            move_storage(error_codes_, batch_to_move.error_codes_);
+            move_storage(failures_, batch_to_move.failures_);
+
+            return (*this);
+        }
+
+        //  Builds a batch from a range of Results with this batch's error code type.
+
+        template <typename TResults>
+        static ResultBatch<TErrorCodeEnum> from_results(const TResults& results)
+        {
+            ResultBatch<TErrorCodeEnum> batch(std::size(results));
+            std::size_t index = 0;
+
+            for (const Result<TErrorCodeEnum>& result : results)
+            {
+                batch.set(index++, result);
+            }
+
+            return (batch);
+        }
+
+        std::size_t size() const { return (size_); }
+
+        bool all_succeeded() const { return (failure_count_ == 0); }
+
+        std::size_t count_failed() const { return (failure_count_); }
+
+        std::size_t count_succeeded() const { return (size_ - failure_count_); }
+
+        bool failed(std::size_t index) const
+        {
+            assert(index < size_);
+            return ((failure_count_ != 0) && ((failure_bits_[index / BITS_PER_WORD] >> (index % BITS_PER_WORD)) & 1));
+        }
+
+        bool succeeded(std::size_t index) const { return (!failed(index)); }
+
+        TErrorCodeEnum error_code(std::size_t index) const
+        {
+            assert(index < size_);
+            return (error_codes_.empty() ? TErrorCodeEnum::SUCCESS : error_codes_[index]);
+        }
+
+        std::string_view message(std::size_t index) const
+        {
+            return (failed(index) ? find_failure(index)->failure_->message() : std::string_view("Success"));
+        }
+
+        //  Index of the first failure, size() if every entry succeeded.
+
+        std::size_t first_failure() const
+        {
+            if (failure_count_ == 0)
+            {
+                return (size_);
+            }
+
+            std::size_t word = 0;
+
+            while (failure_bits_[word] == 0)
+            {
+                word++;
+            }
+
+            return ((word * BITS_PER_WORD) + std::countr_zero(failure_bits_[word]));
+        }
+
+        //  Scans of the packed error code array use the vectorized kernels when the codes are 32 bits wide.
+
+        std::size_t count_error_code(TErrorCodeEnum error_code) const
+        {
+            if (error_codes_.empty())
+            {
+                return (error_code == TErrorCodeEnum::SUCCESS ? size_ : 0);
+            }
+
+            if constexpr (sizeof(TErrorCodeEnum) == sizeof(std::int32_t))
+            {
+                return (
+                    ErrorCodeKernels::count_equal(error_codes_.data(), size_, static_cast<std::int32_t>(error_code)));
+            }
+            else
+            {
+                return (std::count(error_codes_.begin(), error_codes_.end(), error_code));
+            }
+        }
+
+        std::vector<std::size_t> indices_with_error_code(TErrorCodeEnum error_code) const
+        {
+            std::vector<std::size_t> indices;
+
+            if (error_codes_.empty())
+            {
+                if (error_code == TErrorCodeEnum::SUCCESS)
+                {
+                    indices.resize(size_);
+
+                    for (std::size_t index = 0; index < size_; index++)
+                    {
+                        indices[index] = index;
+                    }
+                }
+            }
+            else if constexpr (sizeof(TErrorCodeEnum) == sizeof(std::int32_t))
+            {
+                ErrorCodeKernels::collect_equal(error_codes_.data(), size_, static_cast<std::int32_t>(error_code),
+                                                indices);
+            }
+            else
+            {
+                for (std::size_t index = 0; index < size_; index++)
+                {
+                    if (error_codes_[index] == error_code)
+                    {
+                        indices.push_back(index);
+                    }
+                }
+            }
+
+            return (indices);
+        }
+
+        //  Number of failures for each distinct error code, ordered by first occurrence.  Only failed entries are
+        //      visited so the cost is proportional to the number of failures rather than the size of the batch.
+
+        std::vector<std::pair<TErrorCodeEnum, std::size_t>> error_code_histogram() const
+        {
+            std::vector<std::pair<TErrorCodeEnum, std::size_t>> histogram;
+
+            for (const FailureEntry& entry : failures_)
+            {
+                TErrorCodeEnum error_code = error_codes_[entry.index_];
+
+                auto bucket = std::find_if(histogram.begin(), histogram.end(),
+                                           [error_code](const auto& counted) { return (counted.first == error_code); });
+
+                if (bucket == histogram.end())
+                {
+                    histogram.emplace_back(error_code, 1);
+                }
+                else
+                {
+                    bucket->second++;
+                }
+            }
+
+            return (histogram);
+        }
+
+        //  Records the outcome at index.  A standalone failure is copied into a chain node, a failure which is
+        //      already part of an inner error chain is shared.
+
+        void set(std::size_t index, const Result<TErrorCodeEnum>& result)
+        {
+            assert(index < size_);
+
+            if (result.succeeded())
+            {
+                set_success(index);
+                return;
+            }
+
+            if (failure_bits_.empty())
+            {
+                failure_bits_.resize((size_ + BITS_PER_WORD - 1) / BITS_PER_WORD, 0);
+                error_codes_.resize(size_, TErrorCodeEnum::SUCCESS);
+            }
+
+            auto insert_position = lower_bound(index);
+
+            if (failed(index))
+            {
+                insert_position->failure_ = result.as_inner_error();
+            }
+            else
+            {
+                failures_.insert(insert_position, FailureEntry{index, result.as_inner_error()});
+                failure_bits_[index / BITS_PER_WORD] |= std::uint64_t(1) << (index % BITS_PER_WORD);
+                failure_count_++;
+            }
+
+            error_codes_[index] = result.error_code();
+        }
+
+        void set_success(std::size_t index)
+        {
+            if (!failed(index))
+            {
+                return;
+            }
+
+            failures_.erase(lower_bound(index));
+            failure_bits_[index / BITS_PER_WORD] &= ~(std::uint64_t(1) << (index % BITS_PER_WORD));
+            error_codes_[index] = TErrorCodeEnum::SUCCESS;
+            failure_count_--;
+        }
+
+        //  Converts the outcome at index back into a Result, failures share the stored message and inner error.
+
+        Result<TErrorCodeEnum> result(std::size_t index) const
+        {
+            if (!failed(index))
+            {
+                return (Result<TErrorCodeEnum>::success());
+            }
+
+            return (Result<TErrorCodeEnum>(failure_result(*find_failure(index))));
+        }
+
+        std::vector<Result<TErrorCodeEnum>> to_results() const
+        {
+            std::vector<Result<TErrorCodeEnum>> results;
+
+            results.reserve(size_);
+
+            for (std::size_t index = 0; index < size_; index++)
+            {
+                results.push_back(result(index));
+            }
+
+            return (results);
+        }
+
+        //  Calls function(index, failure) for each failure in index order without copying any of them.
+
+        template <typename TFunction>
+        void for_each_failure(TFunction&& function) const
+        {
+            for (const FailureEntry& entry : failures_)
+            {
+                function(entry.index_, failure_result(entry));
+            }
+        }
+
+        //  The dense arrays are empty until the first failure is recorded.
+
+        const std::uint64_t* failure_bits() const { return (failure_bits_.data()); }
+
+        const TErrorCodeEnum* error_codes() const { return (error_codes_.data()); }
+
+       protected:
+        //  Move assigning a pmr vector allocated from a different resource would copy it, and the copy may throw,
+        //      so in that case the vector is rebuilt by move construction and keeps the resource it was allocated
+        //      from, just as it does when a batch is move constructed.  The source vector is left empty.
+
+        template <typename TVector>
+        static void move_storage(TVector& target, TVector& source) noexcept
+        {
+            if (target.get_allocator() == source.get_allocator())
+            {
+                target.swap(source);
+                source.clear();
+            }
+            else
+            {
+                std::destroy_at(&target);
+                std::construct_at(&target, std::move(source));
+            }
+        }
+
+       private:
+        struct FailureEntry
+        {
+            std::size_t index_;
+
+            InnerErrorPtr failure_;
+        };
+
+        typedef std::pmr::vector<FailureEntry> FailureTable;
+
+        static bool index_less(const FailureEntry& entry, std::size_t index) { return (entry.index_ < index); }
+
+        typename FailureTable::iterator lower_bound(std::size_t index)
+        {
+            return (std::lower_bound(failures_.begin(), failures_.end(), index, index_less));
+        }
+
+        typename FailureTable::const_iterator find_failure(std::size_t index) const
+        {
+            auto entry = std::lower_bound(failures_.begin(), failures_.end(), index, index_less);
+
+            assert((entry != failures_.end()) && (entry->index_ == index));
+
+            return (entry);
+        }
+
+        //  Chain nodes created from a Result<TErrorCodeEnum> are Result<TErrorCodeEnum> instances.
+
+        static const Result<TErrorCodeEnum>& failure_result(const FailureEntry& entry)
+        {
+            return (static_cast<const Result<TErrorCodeEnum>&>(*entry.failure_));
+        }
+
+        std::size_t size_;
+
+        std::size_t failure_count_ = 0;
+
+        std::pmr::vector<std::uint64_t> failure_bits_;
+
+        std::pmr::vector<TErrorCodeEnum> error_codes_;
+
+        FailureTable failures_;
+    };
+
+    //
+    //  ResultBatch carrying a return value for each successful entry in a dense array alongside the outcomes.
+    //      TResultType must be default constructible, entries which failed hold a default constructed value.
+    //
+
+    template <typename TErrorCodeEnum, typename TResultType>
+    class ResultSet : public ResultBatch<TErrorCodeEnum>
+    {
+       public:
+        explicit ResultSet(std::size_t size)
+            : ResultBatch<TErrorCodeEnum>(size), return_values_(size, result_memory_resource())
+        {
+        }
+
+        ResultSet(const ResultSet<TErrorCodeEnum, TResultType>& set_to_copy)
+            : ResultBatch<TErrorCodeEnum>(set_to_copy),
+              return_values_(set_to_copy.return_values_, result_memory_resource())
+        {
+        }
+
+        ResultSet(ResultSet<TErrorCodeEnum, TResultType>&& set_to_move) noexcept
+            : ResultBatch<TErrorCodeEnum>(std::move(set_to_move)), return_values_(std::move(set_to_move.return_values_))
+        {
+        }
+
+        const ResultSet<TErrorCodeEnum, TResultType>& operator=(
+            const ResultSet<TErrorCodeEnum, TResultType>& set_to_copy)
+        {
+            ResultBatch<TErrorCodeEnum>::operator=(set_to_copy);
+            return_values_ = set_to_copy.return_values_;
+
+            return (*this);
+        }
+
+        const ResultSet<TErrorCodeEnum, TResultType>& operator=(
+            ResultSet<TErrorCodeEnum, TResultType>&& set_to_move) noexcept
+        {
+            if (this == &set_to_move)
+            {
+                return (*this);
+            }
+
+            ResultBatch<TErrorCodeEnum>::operator=(std::move(set_to_move));
+            this->move_storage(return_values_, set_to_move.return_values_);
+
+            return (*this);
+        }
+
+        //  Builds a set from a range of results, the return values are moved out of a range passed as an rvalue
+        //      and copied otherwise.
+
+        template <typename TResults>
+        static ResultSet<TErrorCodeEnum, TResultType> from_results(TResults&& results)
+        {
+            ResultSet<TErrorCodeEnum, TResultType> result_set(std::ranges::size(results));
+            std::size_t index = 0;
+
+            for (auto element = std::ranges::begin(results); element != std::ranges::end(results); ++element)
+            {
+                if constexpr (std::is_lvalue_reference_v<TResults>)
+                {
+                    result_set.set(index++, *element);
+                }
+                else
+                {
+                    result_set.set(index++, std::move(*element));
+                }
+            }
+
+            return (result_set);
+        }
+
+        void set(std::size_t index, const ResultWithReturnValue<TErrorCodeEnum, TResultType>& result)
+        {
+            ResultWithReturnValue<TErrorCodeEnum, TResultType> result_copy(result);
+
+            set(index, std::move(result_copy));
+        }
+
+        void set(std::size_t index, ResultWithReturnValue<TErrorCodeEnum, TResultType>&& result)
+        {
+            ResultBatch<TErrorCodeEnum>::set(index, result);
+
+            return_values_[index] = result.succeeded() ? std::move(result.return_value()) : TResultType();
+        }
+
+        //  Hides ResultBatch::set_success, an entry marked successful without a value holds a default
+        //      constructed value rather than whatever it held before.
+
+        void set_success(std::size_t index) { set_success(index, TResultType()); }
+
+        void set_success(std::size_t index, TResultType return_value)
+        {
+            ResultBatch<TErrorCodeEnum>::set_success(index);
+
+            return_values_[index] = std::move(return_value);
+        }
+
+        TResultType& return_value(std::size_t index)
+        {
+            assert(this->succeeded(index));
+            return (return_values_[index]);
+        }
+
+        const TResultType& return_value(std::size_t index) const
+        {
+            assert(this->succeeded(index));
+            return (return_values_[index]);
+        }
+
+        ResultWithReturnValue<TErrorCodeEnum, TResultType> result(std::size_t index) const
+        {
+            if (this->succeeded(index))
+            {
+                return (ResultWithReturnValue<TErrorCodeEnum, TResultType>::success(return_values_[index]));
+            }
+
+            return (ResultWithReturnValue<TErrorCodeEnum, TResultType>(ResultBatch<TErrorCodeEnum>::result(index)));
+        }
+
+       private:
+        std::pmr::vector<TResultType> return_values_;
+    };
+}  // namespace SEFUtility
@@ -0,0 +1,187 @@
+#pragma once
+
+#include <assert.h>
+#include <coroutine>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "CPPResult.hpp"
+
+//
+//  Coroutine support for Result<TErrorCodeEnum> and ResultWithReturnValue<TErrorCodeEnum, TResultType>.  A
+//      function returning either may co_await any Result with the same error code type: a success resumes with
+//      the awaited Result's payload, a failure is propagated as the function's result without cloning its inner
+//      error chain and the function is abandoned.  The function produces its own result with co_return, which
+//      accepts anything the returned Result type can be constructed from.
+//
+//      The coroutines never suspend other than to abandon the frame, so the frame never outlives the call.
+//      Clang can therefore elide the frame allocation altogether, otherwise frames come from the thread's result
+//      memory resource rather than the global heap.
+//
+
+namespace SEFUtility
+{
+    template <typename TResult>
+    class ResultPromise
+    {
+       public:
+        typedef decltype(std::declval<TResult>().error_code()) ErrorCodeType;
+
+        //  The object returned to the caller holds the storage the coroutine's result is written into.  It is
+        //      converted to TResult once the coroutine has returned, which GCC, Clang and MSVC all defer when the
+        //      type returned by get_return_object() differs from the function's return type.
+
+        class ReturnObject
+        {
+           public:
+            explicit ReturnObject(ResultPromise& promise) { promise.result_ = &result_; }
+
+            ReturnObject(const ReturnObject&) = delete;
+            ReturnObject& operator=(const ReturnObject&) = delete;
+
+            operator TResult()
+            {
+                assert(result_);
+                return (std::move(*result_));
+            }
+
+           private:
+            std::optional<TResult> result_;
+        };
+
+        static void* operator new(std::size_t size) { return (allocate_result_block(size)); }
+
+        static void operator delete(void* frame, std::size_t size) { deallocate_result_block(frame, size); }
+
+        ReturnObject get_return_object() { return (ReturnObject(*this)); }
+
+        std::suspend_never initial_suspend() const noexcept { return {}; }
+
+        std::suspend_never final_suspend() const noexcept { return {}; }
+
+        template <typename TValue>
+        void return_value(TValue&& value)
+        {
+            result_->emplace(std::forward<TValue>(value));
+        }
+
+        void unhandled_exception() { throw; }
+
+        template <typename TFailure>
+        void propagate_failure(TFailure&& failure)
+        {
+            static_assert(std::is_same_v<decltype(failure.error_code()), ErrorCodeType>,
+                          "Only Results with the same error code type can be awaited, translate other failures "
+                          "with or_else() first");
+
+            result_->emplace(Result<ErrorCodeType>(std::forward<TFailure>(failure)));
+        }
+
+       private:
+        std::optional<TResult>* result_ = nullptr;
+    };
+
+    //
+    //  Awaiter holding a reference to the awaited Result, an awaited rvalue gives up its payload and failure.
+    //
+
+    template <typename TAwaitedResult>
+    class ResultAwaiter
+    {
+       public:
+        explicit ResultAwaiter(TAwaitedResult&& awaited_result)
+            : awaited_result_(std::forward<TAwaitedResult>(awaited_result))
+        {
+        }
+
+        bool await_ready() const noexcept { return (awaited_result_.succeeded()); }
+
+        //  The frame, and this awaiter with it, is destroyed once the failure has been handed to the promise.
+
+        template <typename TPromise>
+        void await_suspend(std::coroutine_handle<TPromise> handle)
+        {
+            handle.promise().propagate_failure(std::forward<TAwaitedResult>(awaited_result_));
+            handle.destroy();
+        }
+
+        decltype(auto) await_resume() { return (payload(std::forward<TAwaitedResult>(awaited_result_))); }
+
+       private:
+        template <typename TErrorCodeEnum>
+        static void payload(const Result<TErrorCodeEnum>&)
+        {
+        }
+
+        template <typename TErrorCodeEnum, typename TResultType>
+        static TResultType& payload(ResultWithReturnValue<TErrorCodeEnum, TResultType>& result)
+        {
+            return (result.return_value());
+        }
+
+        template <typename TErrorCodeEnum, typename TResultType>
+        static TResultType payload(ResultWithReturnValue<TErrorCodeEnum, TResultType>&& result)
+        {
+            return (std::move(result.return_value()));
+        }
+
+        template <typename TErrorCodeEnum, typename TResultType>
+        static TResultType& payload(ResultWithReturnRef<TErrorCodeEnum, TResultType>& result)
+        {
+            return (result.return_ref());
+        }
+
+        template <typename TErrorCodeEnum, typename TResultType>
+        static TResultType& payload(ResultWithReturnRef<TErrorCodeEnum, TResultType>&& result)
+        {
+            return (result.return_ref());
+        }
+
+        template <typename TErrorCodeEnum, typename TResultType>
+        static std::unique_ptr<TResultType>& payload(ResultWithReturnUniquePtr<TErrorCodeEnum, TResultType>& result)
+        {
+            return (result.return_ptr());
+        }
+
+        template <typename TErrorCodeEnum, typename TResultType>
+        static std::unique_ptr<TResultType> payload(ResultWithReturnUniquePtr<TErrorCodeEnum, TResultType>&& result)
+        {
+            return (std::move(result.return_ptr()));
+        }
+
+        template <typename TErrorCodeEnum, typename TResultType>
+        static std::shared_ptr<TResultType>& payload(ResultWithReturnSharedPtr<TErrorCodeEnum, TResultType>& result)
+        {
+            return (result.return_ptr());
+        }
+
+        template <typename TErrorCodeEnum, typename TResultType>
+        static std::shared_ptr<TResultType> payload(ResultWithReturnSharedPtr<TErrorCodeEnum, TResultType>&& result)
+        {
+            return (std::move(result.return_ptr()));
+        }
+
+        TAwaitedResult&& awaited_result_;
+    };
+
+    template <typename TResult>
+    requires std::is_base_of_v<ResultBase, std::remove_cvref_t<TResult>>
+    ResultAwaiter<TResult> operator co_await(TResult&& result)
+    {
+        return (ResultAwaiter<TResult>(std::forward<TResult>(result)));
+    }
+}  // namespace SEFUtility
+
+template <typename TErrorCodeEnum, typename... Args>
+struct std::coroutine_traits<SEFUtility::Result<TErrorCodeEnum>, Args...>
+{
+    typedef SEFUtility::ResultPromise<SEFUtility::Result<TErrorCodeEnum>> promise_type;
+};
+
+template <typename TErrorCodeEnum, typename TResultType, typename... Args>
+struct std::coroutine_traits<SEFUtility::ResultWithReturnValue<TErrorCodeEnum, TResultType>, Args...>
+{
+    typedef SEFUtility::ResultPromise<SEFUtility::ResultWithReturnValue<TErrorCodeEnum, TResultType>> promise_type;
+};
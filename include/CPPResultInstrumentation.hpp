@@ -0,0 +1,263 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "CPPErrorCodeTraits.hpp"
+
+//
+//  Per error code failure counters.  Defining CPPRESULT_ENABLE_INSTRUMENTATION makes every failure Result count
+//      itself when it is created, copies and moves are not counted.  Without the definition the hook is compiled
+//      out and the counters stay at zero.  The definition must be the same in every translation unit.
+//
+//      Each thread counts into its own cache line aligned table from a fixed pool, so recording a failure is a
+//      thread local lookup and an uncontended relaxed increment with no allocation and no locks.  Tables are
+//      returned to the pool with their counts intact when their thread exits, snapshot() sums every table in
+//      the pool without stopping the threads counting into them.  Rates are found by differencing snapshots.
+//
+
+namespace SEFUtility
+{
+    struct FailureCount
+    {
+        ErrorDomainId error_domain;
+
+        int error_code_value;
+
+        std::uint64_t count;
+    };
+
+    class FailureCounters
+    {
+       public:
+        static constexpr std::size_t CACHE_LINE_SIZE = 64;
+        static constexpr std::size_t MAX_THREADS = 64;
+        static constexpr std::size_t CODES_PER_THREAD = 128;
+
+        static void record(ErrorDomainId error_domain, int error_code_value)
+        {
+            CounterTable* table = thread_table();
+
+            if (table == nullptr)
+            {
+                pool().untracked_.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+
+            std::size_t index = slot_index(error_domain, error_code_value);
+
+            for (std::size_t probe = 0; probe < CODES_PER_THREAD; probe++)
+            {
+                Counter& counter = table->counters_[(index + probe) & (CODES_PER_THREAD - 1)];
+
+                ErrorDomainId domain = counter.error_domain_.load(std::memory_order_relaxed);
+
+                if ((domain == error_domain) && (counter.error_code_value_.load(std::memory_order_relaxed) ==
+                                                 error_code_value))
+                {
+                    increment(counter.count_);
+                    return;
+                }
+
+                if (domain == 0)
+                {
+                    //  Only the owning thread writes to the table, readers see the key once the domain is published.
+
+                    counter.error_code_value_.store(error_code_value, std::memory_order_relaxed);
+                    increment(counter.count_);
+                    counter.error_domain_.store(error_domain, std::memory_order_release);
+                    return;
+                }
+            }
+
+            increment(table->untracked_);
+        }
+
+        //  Counts summed over all threads, ordered by domain and then error code value.
+
+        static std::vector<FailureCount> snapshot()
+        {
+            std::vector<FailureCount> counts;
+
+            for (const CounterTable& table : pool().tables_)
+            {
+                for (const Counter& counter : table.counters_)
+                {
+                    ErrorDomainId domain = counter.error_domain_.load(std::memory_order_acquire);
+
+                    if (domain == 0)
+                    {
+                        continue;
+                    }
+
+                    int error_code_value = counter.error_code_value_.load(std::memory_order_relaxed);
+                    std::uint64_t count = counter.count_.load(std::memory_order_relaxed);
+
+                    auto entry = std::find_if(counts.begin(), counts.end(), [&](const FailureCount& existing) {
+                        return ((existing.error_domain == domain) && (existing.error_code_value == error_code_value));
+                    });
+
+                    if (entry != counts.end())
+                    {
+                        entry->count += count;
+                    }
+                    else
+                    {
+                        counts.push_back(FailureCount{domain, error_code_value, count});
+                    }
+                }
+            }
+
+            std::sort(counts.begin(), counts.end(), [](const FailureCount& first, const FailureCount& second) {
+                return ((first.error_domain < second.error_domain) ||
+                        ((first.error_domain == second.error_domain) &&
+                         (first.error_code_value < second.error_code_value)));
+            });
+
+            return (counts);
+        }
+
+        static std::uint64_t count(ErrorDomainId error_domain, int error_code_value)
+        {
+            std::uint64_t total = 0;
+
+            for (const CounterTable& table : pool().tables_)
+            {
+                for (const Counter& counter : table.counters_)
+                {
+                    if ((counter.error_domain_.load(std::memory_order_acquire) == error_domain) &&
+                        (counter.error_code_value_.load(std::memory_order_relaxed) == error_code_value))
+                    {
+                        total += counter.count_.load(std::memory_order_relaxed);
+                    }
+                }
+            }
+
+            return (total);
+        }
+
+        template <typename TErrorCodeEnum>
+        static std::uint64_t count(TErrorCodeEnum error_code)
+        {
+            return (count(ErrorCodeMetadata<TErrorCodeEnum>::domain_id(), static_cast<int>(error_code)));
+        }
+
+        //  Failures which could not be attributed to an error code because their thread found no free table
+        //      in the pool or its table was full.
+
+        static std::uint64_t untracked()
+        {
+            std::uint64_t total = pool().untracked_.load(std::memory_order_relaxed);
+
+            for (const CounterTable& table : pool().tables_)
+            {
+                total += table.untracked_.load(std::memory_order_relaxed);
+            }
+
+            return (total);
+        }
+
+       private:
+        struct Counter
+        {
+            std::atomic<ErrorDomainId> error_domain_;
+
+            std::atomic<int> error_code_value_;
+
+            std::atomic<std::uint64_t> count_;
+        };
+
+        struct alignas(CACHE_LINE_SIZE) CounterTable
+        {
+            Counter counters_[CODES_PER_THREAD];
+
+            std::atomic<std::uint64_t> untracked_;
+
+            alignas(CACHE_LINE_SIZE) std::atomic<bool> in_use_;
+        };
+
+        //  The pool has static storage duration and is zero initialized, so it is never destroyed and needs
+        //      no allocation.
+
+        struct TablePool
+        {
+            CounterTable tables_[MAX_THREADS];
+
+            std::atomic<std::uint64_t> untracked_;
+        };
+
+        class TableReleaser
+        {
+           public:
+            explicit TableReleaser(CounterTable& table) : table_(table) {}
+
+            TableReleaser(const TableReleaser&) = delete;
+            TableReleaser& operator=(const TableReleaser&) = delete;
+
+            ~TableReleaser() { table_.in_use_.store(false, std::memory_order_release); }
+
+           private:
+            CounterTable& table_;
+        };
+
+        static_assert((CODES_PER_THREAD & (CODES_PER_THREAD - 1)) == 0, "CODES_PER_THREAD must be a power of two");
+
+        static TablePool& pool()
+        {
+            static TablePool table_pool;
+
+            return (table_pool);
+        }
+
+        //  A thread claims a table on its first failure and keeps it until it exits.  Threads finding the pool
+        //      exhausted do not try again.
+
+        static CounterTable* thread_table()
+        {
+            thread_local CounterTable* table = nullptr;
+            thread_local bool claimed = false;
+
+            if (!claimed)
+            {
+                claimed = true;
+                table = claim_table();
+            }
+
+            return (table);
+        }
+
+        static CounterTable* claim_table()
+        {
+            for (CounterTable& table : pool().tables_)
+            {
+                bool in_use = false;
+
+                if (table.in_use_.compare_exchange_strong(in_use, true, std::memory_order_acquire))
+                {
+                    thread_local TableReleaser releaser(table);
+
+                    return (&table);
+                }
+            }
+
+            return (nullptr);
+        }
+
+        static std::size_t slot_index(ErrorDomainId error_domain, int error_code_value)
+        {
+            return (static_cast<std::size_t>(error_domain ^ (static_cast<std::uint64_t>(error_code_value) *
+                                                             0x9E3779B97F4A7C15ULL)) &
+                    (CODES_PER_THREAD - 1));
+        }
+
+        //  Only the owning thread increments, so a relaxed load and store replaces a locked read-modify-write.
+
+        static void increment(std::atomic<std::uint64_t>& count)
+        {
+            count.store(count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+    };
+}  // namespace SEFUtility
@@ -0,0 +1,229 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <memory_resource>
+#include <new>
+
+namespace SEFUtility
+{
+    //
+    //  Memory resource backed by per-thread free lists of fixed size blocks, used by default for Result messages
+    //      and inner error chain nodes so bursts of failures recycle blocks instead of going to the global heap.
+    //      Blocks come from the global heap and any thread may cache any block, so memory allocated on one thread
+    //      may be released on another.  Requests larger than the biggest size class or over-aligned requests go
+    //      straight to the global heap.
+    //
+
+    class ThreadLocalFreeListResource : public std::pmr::memory_resource
+    {
+       public:
+        static constexpr std::size_t SMALLEST_BLOCK_SIZE = 32;
+        static constexpr std::size_t NUMBER_OF_SIZE_CLASSES = 5;
+        static constexpr std::size_t LARGEST_BLOCK_SIZE = SMALLEST_BLOCK_SIZE << (NUMBER_OF_SIZE_CLASSES - 1);
+        static constexpr std::size_t MAX_CACHED_BLOCKS_PER_SIZE_CLASS = 256;
+
+        //  The instance is never destroyed so Results with static storage duration may release memory at exit.
+
+        static ThreadLocalFreeListResource& instance()
+        {
+            static ThreadLocalFreeListResource* resource = new ThreadLocalFreeListResource();
+
+            return (*resource);
+        }
+
+        //  Number of blocks cached by the calling thread, intended for tests and diagnostics.
+
+        static std::size_t cached_blocks()
+        {
+            const FreeLists& free_lists = thread_free_lists();
+            std::size_t total = 0;
+
+            for (std::size_t count : free_lists.counts_)
+            {
+                total += count;
+            }
+
+            return (total);
+        }
+
+       private:
+        struct FreeBlock
+        {
+            FreeBlock* next_;
+        };
+
+        //  FreeLists is trivially destructible so it remains usable by destructors running after the
+        //      FreeListReleaser for the thread has returned its blocks to the global heap.
+
+        struct FreeLists
+        {
+            FreeBlock* heads_[NUMBER_OF_SIZE_CLASSES];
+            std::size_t counts_[NUMBER_OF_SIZE_CLASSES];
+            bool released_;
+        };
+
+        class FreeListReleaser
+        {
+           public:
+            explicit FreeListReleaser(FreeLists& free_lists) : free_lists_(free_lists) {}
+
+            FreeListReleaser(const FreeListReleaser&) = delete;
+            FreeListReleaser& operator=(const FreeListReleaser&) = delete;
+
+            ~FreeListReleaser()
+            {
+                for (std::size_t size_class = 0; size_class < NUMBER_OF_SIZE_CLASSES; size_class++)
+                {
+                    while (free_lists_.heads_[size_class] != nullptr)
+                    {
+                        FreeBlock* block = free_lists_.heads_[size_class];
+
+                        free_lists_.heads_[size_class] = block->next_;
+                        ::operator delete(block);
+                    }
+
+                    free_lists_.counts_[size_class] = 0;
+                }
+
+                free_lists_.released_ = true;
+            }
+
+           private:
+            FreeLists& free_lists_;
+        };
+
+        ThreadLocalFreeListResource() = default;
+
+        static FreeLists& thread_free_lists()
+        {
+            thread_local FreeLists free_lists{};
+            thread_local FreeListReleaser releaser(free_lists);
+
+            return (free_lists);
+        }
+
+        static bool use_global_heap(std::size_t bytes, std::size_t alignment)
+        {
+            return ((bytes > LARGEST_BLOCK_SIZE) || (alignment > alignof(std::max_align_t)));
+        }
+
+        static std::size_t size_class(std::size_t bytes)
+        {
+            return (bytes <= SMALLEST_BLOCK_SIZE ? 0 : std::bit_width((bytes - 1) / SMALLEST_BLOCK_SIZE));
+        }
+
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override
+        {
+            if (use_global_heap(bytes, alignment))
+            {
+                return (::operator new(bytes, std::align_val_t(alignment)));
+            }
+
+            std::size_t block_class = size_class(bytes);
+            FreeLists& free_lists = thread_free_lists();
+            FreeBlock* block = free_lists.heads_[block_class];
+
+            if (block == nullptr)
+            {
+                return (::operator new(SMALLEST_BLOCK_SIZE << block_class));
+            }
+
+            free_lists.heads_[block_class] = block->next_;
+            free_lists.counts_[block_class]--;
+
+            return (block);
+        }
+
+        void do_deallocate(void* block, std::size_t bytes, std::size_t alignment) override
+        {
+            if (use_global_heap(bytes, alignment))
+            {
+                ::operator delete(block, std::align_val_t(alignment));
+                return;
+            }
+
+            std::size_t block_class = size_class(bytes);
+            FreeLists& free_lists = thread_free_lists();
+
+            if (free_lists.released_ || (free_lists.counts_[block_class] >= MAX_CACHED_BLOCKS_PER_SIZE_CLASS))
+            {
+                ::operator delete(block);
+                return;
+            }
+
+            free_lists.heads_[block_class] = new (block) FreeBlock{free_lists.heads_[block_class]};
+            free_lists.counts_[block_class]++;
+        }
+
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return (this == &other); }
+    };
+
+    //
+    //  Each thread allocates Result messages and inner error nodes from its current result memory resource.
+    //      Memory is always returned to the resource it came from, so a resource must outlive every Result
+    //      that allocated from it.
+    //
+
+    inline std::pmr::memory_resource*& thread_result_memory_resource()
+    {
+        thread_local std::pmr::memory_resource* resource = &ThreadLocalFreeListResource::instance();
+
+        return (resource);
+    }
+
+    inline std::pmr::memory_resource* result_memory_resource() { return (thread_result_memory_resource()); }
+
+    //  Passing nullptr restores the default thread local free list resource.  Returns the previous resource.
+
+    inline std::pmr::memory_resource* set_result_memory_resource(std::pmr::memory_resource* resource)
+    {
+        std::pmr::memory_resource* previous_resource = thread_result_memory_resource();
+
+        thread_result_memory_resource() = (resource != nullptr ? resource : &ThreadLocalFreeListResource::instance());
+
+        return (previous_resource);
+    }
+
+    //
+    //  Blocks for heap allocated Result objects, e.g. inner error chain nodes and coroutine frames, come from the
+    //      calling thread's result memory resource.  The resource is recorded in a header ahead of the object so
+    //      the block can be released from any thread.
+    //
+
+    constexpr std::size_t RESULT_BLOCK_HEADER_SIZE = alignof(std::max_align_t);
+
+    inline void* allocate_result_block(std::size_t size)
+    {
+        std::pmr::memory_resource* resource = result_memory_resource();
+        void* block = resource->allocate(size + RESULT_BLOCK_HEADER_SIZE);
+
+        *static_cast<std::pmr::memory_resource**>(block) = resource;
+
+        return (static_cast<std::byte*>(block) + RESULT_BLOCK_HEADER_SIZE);
+    }
+
+    inline void deallocate_result_block(void* object, std::size_t size)
+    {
+        void* block = static_cast<std::byte*>(object) - RESULT_BLOCK_HEADER_SIZE;
+
+        (*static_cast<std::pmr::memory_resource**>(block))->deallocate(block, size + RESULT_BLOCK_HEADER_SIZE);
+    }
+
+    class ScopedResultMemoryResource
+    {
+       public:
+        explicit ScopedResultMemoryResource(std::pmr::memory_resource* resource)
+            : previous_resource_(set_result_memory_resource(resource))
+        {
+        }
+
+        ScopedResultMemoryResource(const ScopedResultMemoryResource&) = delete;
+        ScopedResultMemoryResource& operator=(const ScopedResultMemoryResource&) = delete;
+
+        ~ScopedResultMemoryResource() { set_result_memory_resource(previous_resource_); }
+
+       private:
+        std::pmr::memory_resource* const previous_resource_;
+    };
+}  // namespace SEFUtility
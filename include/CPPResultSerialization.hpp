@@ -0,0 +1,458 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include "CPPResult.hpp"
+
+//
+//  Binary wire format for a Result and its inner error chain, for passing Results between processes or
+//      writing them to logs without formatting text.  All integers are little endian and unaligned:
+//
+//      header      'C' 'R' version(1) reserved(1) node_count(4)
+//      node        status(1) error_domain(8) error_code_value(4) message_length(4) message bytes
+//
+//      Nodes follow the chain outermost first, so a node's position is its depth.  A SerializedResultView reads
+//      a record in place, its nodes return messages as views of the buffer and nothing is allocated until a
+//      Result is rebuilt with materialize().  Source locations and backtraces are not serialized.
+//
+//      Records are input from other processes, so parse() rejects anything malformed with a
+//      WireFormatErrorCodes failure rather than asserting.  Chains are limited to MAX_CHAIN_DEPTH nodes so
+//      that rebuilding and releasing a crafted record cannot exhaust the stack.  serialize() likewise refuses
+//      a Result whose record would exceed the limits of the format rather than writing one parse() rejects.
+//
+
+namespace SEFUtility
+{
+    enum class WireFormatErrorCodes
+    {
+        SUCCESS = 0,
+        TRUNCATED,
+        BAD_HEADER,
+        UNSUPPORTED_VERSION,
+        MALFORMED_CHAIN,
+        UNKNOWN_DOMAIN,
+        CHAIN_TOO_DEEP,
+        MESSAGE_TOO_LONG
+    };
+
+    template <>
+    struct ErrorCodeTraits<WireFormatErrorCodes>
+    {
+        static constexpr ErrorCodeDescription codes[] = {
+            CPPRESULT_ERROR_CODE(WireFormatErrorCodes::TRUNCATED),
+            CPPRESULT_ERROR_CODE(WireFormatErrorCodes::BAD_HEADER),
+            CPPRESULT_ERROR_CODE(WireFormatErrorCodes::UNSUPPORTED_VERSION),
+            CPPRESULT_ERROR_CODE(WireFormatErrorCodes::MALFORMED_CHAIN),
+            CPPRESULT_ERROR_CODE(WireFormatErrorCodes::UNKNOWN_DOMAIN),
+            CPPRESULT_ERROR_CODE(WireFormatErrorCodes::CHAIN_TOO_DEEP),
+            CPPRESULT_ERROR_CODE(WireFormatErrorCodes::MESSAGE_TOO_LONG)};
+    };
+
+    class ResultWireFormat
+    {
+       public:
+        static constexpr std::uint8_t VERSION = 1;
+        static constexpr std::size_t HEADER_SIZE = 8;
+        static constexpr std::size_t NODE_HEADER_SIZE = 17;
+        static constexpr std::size_t MAX_CHAIN_DEPTH = 1024;
+        static constexpr std::size_t MAX_MESSAGE_SIZE = UINT32_MAX;
+
+        static std::size_t serialized_size(const ResultBase& result)
+        {
+            std::size_t size = HEADER_SIZE;
+
+            for (const ResultBase* node = &result; node != nullptr; node = node->inner_error().get())
+            {
+                size += NODE_HEADER_SIZE + node->message().size();
+            }
+
+            return (size);
+        }
+
+        //  The rule for the nodes of a record, applied by serialize() as well as parse() so that every record
+        //      written can be read back.  Only the outermost node may be a success, and a success has no inner
+        //      error.  A failure must carry an error code, zero is reserved for SUCCESS in every domain.
+
+        static std::optional<StaticMessage> malformed_node(bool failed, int error_code_value, std::size_t depth,
+                                                           bool has_inner_error)
+        {
+            if (!failed && ((depth != 0) || has_inner_error))
+            {
+                return (StaticMessage("Record chain contains a success"));
+            }
+
+            if (failed && (error_code_value == 0))
+            {
+                return (StaticMessage("Record failure has no error code"));
+            }
+
+            return (std::nullopt);
+        }
+
+        //  Appends the record for the result to the buffer.  A chain deeper than MAX_CHAIN_DEPTH, a message longer
+        //      than MAX_MESSAGE_SIZE or a node breaking the rule of malformed_node() fails and leaves the buffer
+        //      unchanged.
+
+        static Result<WireFormatErrorCodes> serialize(const ResultBase& result, std::vector<std::byte>& buffer)
+        {
+            std::size_t record_size = HEADER_SIZE;
+            std::uint32_t node_count = 0;
+
+            for (const ResultBase* node = &result; node != nullptr; node = node->inner_error().get())
+            {
+                if (++node_count > MAX_CHAIN_DEPTH)
+                {
+                    return (Result<WireFormatErrorCodes>::failure(
+                        WireFormatErrorCodes::CHAIN_TOO_DEEP, StaticMessage("Result chain is deeper than the limit")));
+                }
+
+                if (std::optional<StaticMessage> malformed = malformed_node(
+                        node->failed(), node->error_code_value(), node_count - 1, bool(node->inner_error())))
+                {
+                    return (Result<WireFormatErrorCodes>::failure(WireFormatErrorCodes::MALFORMED_CHAIN, *malformed));
+                }
+
+                if (node->message().size() > MAX_MESSAGE_SIZE)
+                {
+                    return (Result<WireFormatErrorCodes>::failure(WireFormatErrorCodes::MESSAGE_TOO_LONG,
+                                                                  StaticMessage("Result message is too long")));
+                }
+
+                record_size += NODE_HEADER_SIZE + node->message().size();
+            }
+
+            std::size_t offset = buffer.size();
+
+            buffer.resize(offset + record_size);
+
+            std::byte* output = buffer.data() + offset + HEADER_SIZE;
+
+            for (const ResultBase* node = &result; node != nullptr; node = node->inner_error().get())
+            {
+                std::string_view message = node->message();
+
+                store(output, std::uint8_t(node->failed() ? 1 : 0));
+                store(output + 1, std::uint64_t(node->error_domain()));
+                store(output + 9, std::uint32_t(node->error_code_value()));
+                store(output + 13, std::uint32_t(message.size()));
+                std::copy_n(reinterpret_cast<const std::byte*>(message.data()), message.size(), output + 17);
+
+                output += NODE_HEADER_SIZE + message.size();
+            }
+
+            output = buffer.data() + offset;
+
+            output[0] = std::byte('C');
+            output[1] = std::byte('R');
+            output[2] = std::byte(VERSION);
+            output[3] = std::byte(0);
+            store(output + 4, node_count);
+
+            return (Result<WireFormatErrorCodes>::success());
+        }
+
+        template <typename TInteger>
+        static void store(std::byte* output, TInteger value)
+        {
+            for (std::size_t i = 0; i < sizeof(TInteger); i++)
+            {
+                output[i] = std::byte((value >> (8 * i)) & 0xFF);
+            }
+        }
+
+        template <typename TInteger>
+        static TInteger load(const std::byte* input)
+        {
+            TInteger value = 0;
+
+            for (std::size_t i = 0; i < sizeof(TInteger); i++)
+            {
+                value |= static_cast<TInteger>(std::to_integer<std::uint8_t>(input[i])) << (8 * i);
+            }
+
+            return (value);
+        }
+    };
+
+    //
+    //  Read only view of one serialized record.  The view refers to the buffer it was parsed from, which must
+    //      outlive it and every message view taken from it.
+    //
+
+    class SerializedResultView
+    {
+       public:
+        class Node
+        {
+           public:
+            bool succeeded() const { return (!failed()); }
+
+            bool failed() const { return (ResultWireFormat::load<std::uint8_t>(data_) != 0); }
+
+            ErrorDomainId error_domain() const { return (ResultWireFormat::load<std::uint64_t>(data_ + 1)); }
+
+            int error_code_value() const { return (int(ResultWireFormat::load<std::uint32_t>(data_ + 9))); }
+
+            std::string_view message() const
+            {
+                return (std::string_view(reinterpret_cast<const char*>(data_ + ResultWireFormat::NODE_HEADER_SIZE),
+                                         message_length()));
+            }
+
+            std::size_t depth() const { return (depth_); }
+
+            template <typename TErrorCodeEnum>
+            bool is_code(TErrorCodeEnum error_code) const
+            {
+                return ((error_domain() == ErrorCodeMetadata<TErrorCodeEnum>::domain_id()) &&
+                        (error_code_value() == static_cast<int>(error_code)));
+            }
+
+           private:
+            friend class SerializedResultView;
+
+            Node(const std::byte* data, std::size_t depth) : data_(data), depth_(depth) {}
+
+            std::size_t message_length() const { return (ResultWireFormat::load<std::uint32_t>(data_ + 13)); }
+
+            std::size_t size_bytes() const { return (ResultWireFormat::NODE_HEADER_SIZE + message_length()); }
+
+            const std::byte* data_;
+
+            std::size_t depth_;
+        };
+
+        class iterator
+        {
+           public:
+            typedef std::forward_iterator_tag iterator_category;
+            typedef Node value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef const Node* pointer;
+            typedef const Node& reference;
+
+            iterator() : node_(nullptr, 0) {}
+
+            const Node& operator*() const { return (node_); }
+
+            const Node* operator->() const { return (&node_); }
+
+            iterator& operator++()
+            {
+                node_ = Node(node_.data_ + node_.size_bytes(), node_.depth_ + 1);
+                return (*this);
+            }
+
+            iterator operator++(int)
+            {
+                iterator previous = *this;
+                ++(*this);
+                return (previous);
+            }
+
+            bool operator==(const iterator& other) const { return (node_.depth_ == other.node_.depth_); }
+
+           private:
+            friend class SerializedResultView;
+
+            iterator(const std::byte* data, std::size_t depth) : node_(data, depth) {}
+
+            Node node_;
+        };
+
+        //  Checks the header and that every node lies within the buffer, nothing is copied.  Trailing bytes
+        //      after the record are ignored, size_bytes() gives the offset of the next record in a stream.
+
+        static ResultWithReturnValue<WireFormatErrorCodes, SerializedResultView> parse(
+            std::span<const std::byte> buffer)
+        {
+            typedef ResultWithReturnValue<WireFormatErrorCodes, SerializedResultView> ParseResult;
+
+            if (buffer.size() < ResultWireFormat::HEADER_SIZE)
+            {
+                return (ParseResult::failure(WireFormatErrorCodes::TRUNCATED,
+                                             StaticMessage("Record header is truncated")));
+            }
+
+            if ((buffer[0] != std::byte('C')) || (buffer[1] != std::byte('R')))
+            {
+                return (ParseResult::failure(WireFormatErrorCodes::BAD_HEADER,
+                                             StaticMessage("Record header is not recognized")));
+            }
+
+            if (std::to_integer<std::uint8_t>(buffer[2]) != ResultWireFormat::VERSION)
+            {
+                return (ParseResult::failure(WireFormatErrorCodes::UNSUPPORTED_VERSION,
+                                             StaticMessage("Record version is not supported")));
+            }
+
+            std::size_t node_count = ResultWireFormat::load<std::uint32_t>(buffer.data() + 4);
+            std::size_t offset = ResultWireFormat::HEADER_SIZE;
+
+            if (node_count == 0)
+            {
+                return (ParseResult::failure(WireFormatErrorCodes::MALFORMED_CHAIN,
+                                             StaticMessage("Record has no nodes")));
+            }
+
+            if (node_count > ResultWireFormat::MAX_CHAIN_DEPTH)
+            {
+                return (ParseResult::failure(WireFormatErrorCodes::MALFORMED_CHAIN,
+                                             StaticMessage("Record chain is deeper than the limit")));
+            }
+
+            for (std::size_t depth = 0; depth < node_count; depth++)
+            {
+                if (buffer.size() - offset < ResultWireFormat::NODE_HEADER_SIZE)
+                {
+                    return (ParseResult::failure(WireFormatErrorCodes::TRUNCATED,
+                                                 StaticMessage("Record node is truncated")));
+                }
+
+                Node node(buffer.data() + offset, depth);
+
+                if (buffer.size() - offset < node.size_bytes())
+                {
+                    return (ParseResult::failure(WireFormatErrorCodes::TRUNCATED,
+                                                 StaticMessage("Record message is truncated")));
+                }
+
+                if (std::optional<StaticMessage> malformed = ResultWireFormat::malformed_node(
+                        node.failed(), node.error_code_value(), depth, depth + 1 < node_count))
+                {
+                    return (ParseResult::failure(WireFormatErrorCodes::MALFORMED_CHAIN, *malformed));
+                }
+
+                offset += node.size_bytes();
+            }
+
+            return (ParseResult::success(SerializedResultView(buffer.data(), node_count, offset)));
+        }
+
+        std::size_t node_count() const { return (node_count_); }
+
+        std::size_t size_bytes() const { return (size_bytes_); }
+
+        Node outermost() const { return (*begin()); }
+
+        iterator begin() const { return (iterator(data_ + ResultWireFormat::HEADER_SIZE, 0)); }
+
+        iterator end() const { return (iterator(nullptr, node_count_)); }
+
+        template <typename TErrorCodeEnum>
+        bool contains_code(TErrorCodeEnum error_code) const
+        {
+            for (const Node& node : *this)
+            {
+                if (node.is_code(error_code))
+                {
+                    return (true);
+                }
+            }
+
+            return (false);
+        }
+
+        //  Rebuilds the Result.  The outermost node must be in the domain of TErrorCodeEnum and each inner node
+        //      in the domain of TErrorCodeEnum or one of TInnerErrorCodeEnums.
+
+        template <typename TErrorCodeEnum, typename... TInnerErrorCodeEnums>
+        ResultWithReturnValue<WireFormatErrorCodes, Result<TErrorCodeEnum>> materialize() const
+        {
+            typedef ResultWithReturnValue<WireFormatErrorCodes, Result<TErrorCodeEnum>> MaterializeResult;
+
+            iterator outer_node = begin();
+
+            if (outer_node->error_domain() != ErrorCodeMetadata<TErrorCodeEnum>::domain_id())
+            {
+                return (MaterializeResult::failure(WireFormatErrorCodes::UNKNOWN_DOMAIN,
+                                                   StaticMessage("Outermost error code is in an unknown domain")));
+            }
+
+            TErrorCodeEnum error_code = static_cast<TErrorCodeEnum>(outer_node->error_code_value());
+
+            if (outer_node->succeeded())
+            {
+                return (MaterializeResult::success(Result<TErrorCodeEnum>::success()));
+            }
+
+            if (node_count_ == 1)
+            {
+                return (MaterializeResult::success(Result<TErrorCodeEnum>::failure(error_code, outer_node->message())));
+            }
+
+            InnerErrorPtr inner_error = materialize_chain<TErrorCodeEnum, TInnerErrorCodeEnums...>(++begin());
+
+            if (!inner_error)
+            {
+                return (MaterializeResult::failure(WireFormatErrorCodes::UNKNOWN_DOMAIN,
+                                                   StaticMessage("Inner error code is in an unknown domain")));
+            }
+
+            return (MaterializeResult::success(
+                Result<TErrorCodeEnum>::failure(*inner_error, error_code, outer_node->message())));
+        }
+
+       private:
+        SerializedResultView(const std::byte* data, std::size_t node_count, std::size_t size_bytes)
+            : data_(data), node_count_(node_count), size_bytes_(size_bytes)
+        {
+        }
+
+        //  Builds the chain from the node onwards, starting from the innermost node and wrapping outwards, so the
+        //      depth of the chain does not use stack.  Returns null if any node's domain is unknown.
+
+        template <typename... TErrorCodeEnums>
+        InnerErrorPtr materialize_chain(iterator first_node) const
+        {
+            std::vector<Node> nodes(first_node, end());
+
+            InnerErrorPtr inner_error;
+
+            for (auto node = nodes.rbegin(); node != nodes.rend(); ++node)
+            {
+                InnerErrorPtr chain_node;
+
+                ((node->error_domain() == ErrorCodeMetadata<TErrorCodeEnums>::domain_id()
+                      ? (chain_node = materialize_node<TErrorCodeEnums>(*node, inner_error), true)
+                      : false) ||
+                 ...);
+
+                if (!chain_node)
+                {
+                    return (nullptr);
+                }
+
+                inner_error = std::move(chain_node);
+            }
+
+            return (inner_error);
+        }
+
+        template <typename TErrorCodeEnum>
+        static InnerErrorPtr materialize_node(const Node& node, const InnerErrorPtr& inner_error)
+        {
+            TErrorCodeEnum error_code = static_cast<TErrorCodeEnum>(node.error_code_value());
+
+            if (inner_error)
+            {
+                return (Result<TErrorCodeEnum>::failure(*inner_error, error_code, node.message()).as_inner_error());
+            }
+
+            return (Result<TErrorCodeEnum>::failure(error_code, node.message()).as_inner_error());
+        }
+
+        const std::byte* data_;
+
+        std::size_t node_count_;
+
+        std::size_t size_bytes_;
+    };
+}  // namespace SEFUtility
@@ -0,0 +1,84 @@
+#include "AllocationCounter.hpp"
+
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    thread_local std::size_t allocation_count = 0;
+
+    void* counted_allocation(std::size_t size)
+    {
+        allocation_count++;
+
+        void* block = std::malloc(size == 0 ? 1 : size);
+
+        if (block == nullptr)
+        {
+            throw std::bad_alloc();
+        }
+
+        return (block);
+    }
+
+    void* counted_aligned_allocation(std::size_t size, std::align_val_t alignment)
+    {
+        allocation_count++;
+
+        std::size_t block_alignment = static_cast<std::size_t>(alignment);
+        std::size_t block_size = ((size + block_alignment - 1) / block_alignment) * block_alignment;
+        void* block = std::aligned_alloc(block_alignment, block_size == 0 ? block_alignment : block_size);
+
+        if (block == nullptr)
+        {
+            throw std::bad_alloc();
+        }
+
+        return (block);
+    }
+}  // namespace
+
+std::size_t SEFUtilityTest::thread_allocation_count() { return (allocation_count); }
+
+void* operator new(std::size_t size) { return (counted_allocation(size)); }
+
+void* operator new[](std::size_t size) { return (counted_allocation(size)); }
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    allocation_count++;
+    return (std::malloc(size == 0 ? 1 : size));
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    allocation_count++;
+    return (std::malloc(size == 0 ? 1 : size));
+}
+
+void operator delete(void* block) noexcept { std::free(block); }
+
+void operator delete[](void* block) noexcept { std::free(block); }
+
+void operator delete(void* block, std::size_t) noexcept { std::free(block); }
+
+void operator delete[](void* block, std::size_t) noexcept { std::free(block); }
+
+void operator delete(void* block, const std::nothrow_t&) noexcept { std::free(block); }
+
+void operator delete[](void* block, const std::nothrow_t&) noexcept { std::free(block); }
+
+void* operator new(std::size_t size, std::align_val_t alignment) { return (counted_aligned_allocation(size, alignment)); }
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return (counted_aligned_allocation(size, alignment));
+}
+
+void operator delete(void* block, std::align_val_t) noexcept { std::free(block); }
+
+void operator delete[](void* block, std::align_val_t) noexcept { std::free(block); }
+
+void operator delete(void* block, std::size_t, std::align_val_t) noexcept { std::free(block); }
+
+void operator delete[](void* block, std::size_t, std::align_val_t) noexcept { std::free(block); }
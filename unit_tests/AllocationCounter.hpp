@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstddef>
+
+//
+//  Counts the global operator new calls made by the current thread while an instance is in scope.
+//      The replacement allocation functions live in AllocationCounter.cpp.
+//
+
+namespace SEFUtilityTest
+{
+    std::size_t thread_allocation_count();
+
+    class AllocationCounter
+    {
+       public:
+        AllocationCounter() : starting_count_(thread_allocation_count()) {}
+
+        std::size_t allocations() const { return (thread_allocation_count() - starting_count_); }
+
+       private:
+        const std::size_t starting_count_;
+    };
+}  // namespace SEFUtilityTest
@@ -0,0 +1,231 @@
+#include <catch2/catch_all.hpp>
+
+#include <array>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include "AllocationCounter.hpp"
+#include "CPPAsyncResult.hpp"
+
+//  The pragma below is to disable to false errors flagged by intellisense for
+//  Catch2 REQUIRE macros.
+
+#if __INTELLISENSE__
+#pragma diag_suppress 2486
+#endif
+
+using SEFUtility::AsyncResult;
+using SEFUtility::AsyncResultPromise;
+using SEFUtility::PromiseErrorCodes;
+using SEFUtility::Result;
+using SEFUtility::ResultWithReturnValue;
+using SEFUtility::ScopedResultMemoryResource;
+using SEFUtilityTest::AllocationCounter;
+
+enum class AsyncErrorCodes
+{
+    SUCCESS = 0,
+    TASK_FAILED = 1000,
+    CONTINUATION_FAILED
+};
+
+enum class TaskErrorCodes
+{
+    SUCCESS = 0,
+    BROKEN_PROMISE = 1000
+};
+
+typedef ResultWithReturnValue<AsyncErrorCodes, int> IntResult;
+typedef ResultWithReturnValue<AsyncErrorCodes, std::string> StringResult;
+
+TEST_CASE("Async Result Test", "[async-checks]")
+{
+    {
+        //  A single allocation holds the whole exchange.
+
+        ScopedResultMemoryResource heap_resource(std::pmr::new_delete_resource());
+        AllocationCounter counter;
+
+        AsyncResultPromise<AsyncErrorCodes, int> promise;
+        AsyncResult<AsyncErrorCodes, int> async_result = promise.get_async_result();
+
+        REQUIRE(!async_result.ready());
+
+        promise.set_result(IntResult::success(5));
+
+        REQUIRE(async_result.ready());
+        REQUIRE(async_result.get().return_value() == 5);
+        REQUIRE(!async_result.valid());
+        REQUIRE(counter.allocations() == 1);
+    }
+
+    {
+        //  get() blocks until a result set on another thread arrives, failures arrive intact.
+
+        auto inner = Result<AsyncErrorCodes>::failure(AsyncErrorCodes::TASK_FAILED, "inner");
+
+        AsyncResultPromise<AsyncErrorCodes, int> promise;
+        AsyncResult<AsyncErrorCodes, int> async_result = promise.get_async_result();
+
+        std::thread producer([promise = std::move(promise), &inner]() mutable {
+            promise.set_result(IntResult::failure(inner, AsyncErrorCodes::TASK_FAILED, "task {} failed", 7));
+        });
+
+        auto testResult1 = async_result.get();
+
+        producer.join();
+
+        REQUIRE(testResult1.failed());
+        REQUIRE(testResult1.message() == "task 7 failed");
+        REQUIRE(testResult1.inner_error()->message() == "inner");
+    }
+
+    {
+        //  Continuations run inline, on the producer's thread or immediately if the result is already set.
+
+        AsyncResultPromise<AsyncErrorCodes, int> promise;
+        std::thread::id continuation_thread;
+        int value = 0;
+
+        promise.get_async_result().then([&](IntResult&& result) {
+            continuation_thread = std::this_thread::get_id();
+            value = result.return_value();
+        });
+
+        std::thread producer([&promise]() { promise.set_result(IntResult::success(11)); });
+        std::thread::id producer_thread = producer.get_id();
+
+        producer.join();
+
+        REQUIRE(value == 11);
+        REQUIRE(continuation_thread == producer_thread);
+
+        AsyncResultPromise<AsyncErrorCodes, int> completed_promise;
+        AsyncResult<AsyncErrorCodes, int> completed_result = completed_promise.get_async_result();
+
+        completed_promise.set_result(IntResult::success(12));
+        completed_result.then([&value](IntResult&& result) { value = result.return_value(); });
+
+        REQUIRE(value == 12);
+    }
+
+    {
+        //  Continuations too large to store inline still run.
+
+        std::array<int, 32> large_capture{};
+        int sum = 0;
+
+        large_capture.fill(1);
+
+        AsyncResultPromise<AsyncErrorCodes, int> promise;
+
+        promise.get_async_result().then([large_capture, &sum](IntResult&& result) {
+            for (int element : large_capture)
+            {
+                sum += element;
+            }
+
+            sum += result.return_value();
+        });
+
+        promise.set_result(IntResult::success(100));
+
+        REQUIRE(sum == 132);
+    }
+
+    {
+        //  and_then chains across threads and skips its function for failures.
+
+        AsyncResultPromise<AsyncErrorCodes, int> promise;
+
+        auto async_result = promise.get_async_result().and_then([](int&& value) {
+            return (value > 0 ? StringResult::success(std::to_string(value))
+                              : StringResult::failure(AsyncErrorCodes::CONTINUATION_FAILED, "not positive"));
+        });
+
+        std::thread producer([&promise]() { promise.set_result(IntResult::success(42)); });
+
+        REQUIRE(async_result.get().return_value() == "42");
+
+        producer.join();
+
+        AsyncResultPromise<AsyncErrorCodes, int> failed_promise;
+        bool called = false;
+
+        auto failed_result = failed_promise.get_async_result().and_then([&called](int&& value) {
+            called = true;
+            return (StringResult::success(std::to_string(value)));
+        });
+
+        failed_promise.set_result(IntResult::failure(AsyncErrorCodes::TASK_FAILED, "task failed"));
+
+        auto testResult1 = failed_result.get();
+
+        REQUIRE(!called);
+        REQUIRE(testResult1.error_code() == AsyncErrorCodes::TASK_FAILED);
+        REQUIRE(testResult1.message() == "task failed");
+    }
+}
+
+TEST_CASE("Async Result Broken Promise Test", "[async-checks]")
+{
+    {
+        //  A promise dropped by another thread without a result wakes the consumer with a failure.
+
+        AsyncResultPromise<AsyncErrorCodes, int> promise;
+        AsyncResult<AsyncErrorCodes, int> async_result = promise.get_async_result();
+
+        std::thread producer([promise = std::move(promise)]() mutable {});
+
+        IntResult result = async_result.get();
+
+        producer.join();
+
+        REQUIRE(result.failed());
+        REQUIRE(result.error_code_value() == -1);
+        REQUIRE(result.message() == "Broken promise");
+        REQUIRE(result.contains_code(PromiseErrorCodes::BROKEN_PROMISE));
+    }
+
+    {
+        //  Enums declaring BROKEN_PROMISE receive it as the code, continuations run with the failure.
+
+        ResultWithReturnValue<TaskErrorCodes, int> continued = ResultWithReturnValue<TaskErrorCodes, int>::success(0);
+
+        {
+            AsyncResultPromise<TaskErrorCodes, int> promise;
+
+            promise.get_async_result().then([&continued](ResultWithReturnValue<TaskErrorCodes, int>&& result) {
+                continued = std::move(result);
+            });
+        }
+
+        REQUIRE(continued.failed());
+        REQUIRE(continued.error_code() == TaskErrorCodes::BROKEN_PROMISE);
+        REQUIRE(continued.inner_error()->message() == "Promise destroyed without a result");
+    }
+
+    {
+        //  A continuation which throws drops the promise it was to complete, and_then passes the failure on.
+
+        AsyncResultPromise<AsyncErrorCodes, int> promise;
+
+        auto chained = promise.get_async_result().and_then([](int value) -> IntResult {
+            if (value < 0)
+            {
+                throw std::runtime_error("negative value");
+            }
+
+            return (IntResult::success(value));
+        });
+
+        REQUIRE_THROWS_AS(promise.set_result(IntResult::success(-1)), std::runtime_error);
+
+        auto result = chained.get();
+
+        REQUIRE(result.failed());
+        REQUIRE(result.contains_code(PromiseErrorCodes::BROKEN_PROMISE));
+    }
+}
@@ -0,0 +1,122 @@
+#include <catch2/catch_all.hpp>
+
+#include "AllocationCounter.hpp"
+#include "CPPCodeOnlyResult.hpp"
+#include "CPPResult.hpp"
+
+//  The pragma below is to disable to false errors flagged by intellisense for
+//  Catch2 REQUIRE macros.
+
+#if __INTELLISENSE__
+#pragma diag_suppress 2486
+#endif
+
+using SEFUtility::CodeOnlyResult;
+using SEFUtility::Result;
+using SEFUtilityTest::AllocationCounter;
+
+using namespace SEFUtility::literals;
+
+enum class DecodeErrorCodes
+{
+    SUCCESS = 0,
+    TRUNCATED = 1000,
+    BAD_CHECKSUM
+};
+
+enum class DecodeByteErrorCodes : unsigned char
+{
+    SUCCESS = 0,
+    TRUNCATED
+};
+
+template <>
+struct SEFUtility::ErrorCodeTraits<DecodeErrorCodes>
+{
+    static constexpr ErrorCodeDescription codes[] = {
+        CPPRESULT_ERROR_CODE(DecodeErrorCodes::TRUNCATED, ErrorSeverity::FAILURE, true),
+        CPPRESULT_ERROR_CODE(DecodeErrorCodes::BAD_CHECKSUM)};
+};
+
+//  The error code is the whole object.
+
+static_assert(sizeof(CodeOnlyResult<DecodeErrorCodes>) == sizeof(DecodeErrorCodes));
+static_assert(sizeof(CodeOnlyResult<DecodeByteErrorCodes>) == 1);
+static_assert(std::is_trivially_copyable_v<CodeOnlyResult<DecodeErrorCodes>>);
+static_assert(CodeOnlyResult<DecodeErrorCodes>::success().succeeded());
+static_assert(CodeOnlyResult<DecodeErrorCodes>::failure(DecodeErrorCodes::TRUNCATED, "message {}", 1).failed());
+static_assert(CodeOnlyResult<DecodeErrorCodes>::failure(DecodeErrorCodes::TRUNCATED, "truncated").error_code_name() ==
+              "TRUNCATED");
+
+//  The same call sites compile against Result and CodeOnlyResult.
+
+template <typename TResult>
+static TResult decode_packet(int length, int checksum)
+{
+    if (length < 4)
+    {
+        return (TResult::failure(DecodeErrorCodes::TRUNCATED, "Packet of {} bytes is truncated", length));
+    }
+
+    if (checksum != 0)
+    {
+        auto checksum_failure = TResult::failure(DecodeErrorCodes::BAD_CHECKSUM, "Bad checksum"_msg);
+
+        return (TResult::failure(checksum_failure, DecodeErrorCodes::BAD_CHECKSUM, "Packet rejected"));
+    }
+
+    return (TResult::success());
+}
+
+TEST_CASE("Code Only Result Test", "[code-only-checks]")
+{
+    {
+        AllocationCounter counter;
+
+        auto testResult1 = decode_packet<CodeOnlyResult<DecodeErrorCodes>>(8, 0);
+        auto testResult2 = decode_packet<CodeOnlyResult<DecodeErrorCodes>>(2, 0);
+        auto testResult3 = decode_packet<CodeOnlyResult<DecodeErrorCodes>>(8, 1);
+
+        REQUIRE(counter.allocations() == 0);
+
+        REQUIRE(testResult1.succeeded());
+        REQUIRE(testResult1.error_code() == DecodeErrorCodes::SUCCESS);
+        REQUIRE(testResult1.message() == "Success");
+
+        REQUIRE(testResult2.failed());
+        REQUIRE(testResult2.error_code() == DecodeErrorCodes::TRUNCATED);
+        REQUIRE(testResult2.error_code_value() == 1000);
+        REQUIRE(testResult2.retryable());
+        REQUIRE(testResult2.message().empty());
+        REQUIRE(!testResult2.inner_error());
+
+        REQUIRE(testResult3.error_code() == DecodeErrorCodes::BAD_CHECKSUM);
+        REQUIRE(!testResult3.retryable());
+        REQUIRE(testResult3.error_domain() == SEFUtility::ErrorCodeMetadata<DecodeErrorCodes>::domain_id());
+    }
+
+    {
+        //  Full Results from the same call sites keep their messages and inner errors.
+
+        auto testResult1 = decode_packet<Result<DecodeErrorCodes>>(2, 0);
+        auto testResult2 = decode_packet<Result<DecodeErrorCodes>>(8, 1);
+
+        REQUIRE(testResult1.message() == "Packet of 2 bytes is truncated");
+        REQUIRE(testResult2.inner_error()->message() == "Bad checksum");
+    }
+
+    {
+        //  Inner errors of any kind are accepted and dropped, lazy failures are never rendered.
+
+        auto inner = Result<DecodeErrorCodes>::failure(DecodeErrorCodes::TRUNCATED, "inner");
+        auto testResult1 =
+            CodeOnlyResult<DecodeByteErrorCodes>::failure(inner, DecodeByteErrorCodes::TRUNCATED, "outer {}", 1);
+        auto testResult2 =
+            CodeOnlyResult<DecodeErrorCodes>::lazy_failure(testResult1, DecodeErrorCodes::BAD_CHECKSUM, "lazy {}", 2);
+        auto testResult3 = CodeOnlyResult<DecodeErrorCodes>::lazy_failure(DecodeErrorCodes::TRUNCATED, "lazy");
+
+        REQUIRE(testResult1.error_code() == DecodeByteErrorCodes::TRUNCATED);
+        REQUIRE(testResult2.error_code() == DecodeErrorCodes::BAD_CHECKSUM);
+        REQUIRE(testResult3.failed());
+    }
+}
@@ -0,0 +1,453 @@
+#include <catch2/catch_all.hpp>
+
+#include <cstddef>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+
+#include "AllocationCounter.hpp"
+#include "CPPCompactResult.hpp"
+#include "CopyCounter.hpp"
+
+//  The pragma below is to disable to false errors flagged by intellisense for
+//  Catch2 REQUIRE macros.
+
+#if __INTELLISENSE__
+#pragma diag_suppress 2486
+#endif
+
+using SEFUtility::CompactResult;
+using SEFUtility::CompactResultWithReturnValue;
+using SEFUtility::Result;
+using SEFUtility::ResultWithReturnValue;
+using SEFUtilityTest::AllocationCounter;
+using SEFUtilityTest::CopyCounter;
+using SEFUtilityTest::CountedPayload;
+
+enum class CompactErrorCodes
+{
+    SUCCESS = 0,
+    FAILURE_1 = 1000,
+    FAILURE_2,
+    FAILURE_3
+};
+
+enum class CompactByteErrorCodes : unsigned char
+{
+    SUCCESS = 0,
+    FAILURE_1
+};
+
+//  A success is a single enum-sized word plus the null failure details pointer, and can be
+//      produced in constant evaluation.
+
+static_assert(sizeof(CompactResult<CompactErrorCodes>) == 2 * sizeof(void*));
+static_assert(sizeof(CompactResult<CompactByteErrorCodes>) == 2 * sizeof(void*));
+static_assert(sizeof(CompactResult<CompactErrorCodes>) < sizeof(Result<CompactErrorCodes>));
+static_assert(std::is_nothrow_move_constructible_v<CompactResult<CompactErrorCodes>>);
+static_assert(std::is_nothrow_move_assignable_v<CompactResult<CompactErrorCodes>>);
+static_assert(!std::is_polymorphic_v<CompactResult<CompactErrorCodes>>);
+static_assert(CompactResult<CompactErrorCodes>::success().succeeded());
+static_assert(CompactResult<CompactErrorCodes>::success().error_code() == CompactErrorCodes::SUCCESS);
+
+//  The return value and the failure pointer share storage, so a success is the return value plus the
+//      error code padded to the alignment of the larger of the two.
+
+struct CompactPayload
+{
+    double values[4];
+};
+
+static_assert(sizeof(CompactResultWithReturnValue<CompactErrorCodes, int>) == 2 * sizeof(void*));
+static_assert(sizeof(CompactResultWithReturnValue<CompactErrorCodes, CompactPayload>) ==
+              sizeof(CompactPayload) + sizeof(void*));
+static_assert(sizeof(CompactResultWithReturnValue<CompactErrorCodes, int>) <
+              sizeof(ResultWithReturnValue<CompactErrorCodes, int>));
+static_assert(std::is_nothrow_move_constructible_v<CompactResultWithReturnValue<CompactErrorCodes, int>>);
+static_assert(std::is_nothrow_move_assignable_v<CompactResultWithReturnValue<CompactErrorCodes, int>>);
+static_assert(!std::is_polymorphic_v<CompactResultWithReturnValue<CompactErrorCodes, int>>);
+
+//  Counts the payloads alive so the tests can check that exactly one member of the union is ever destroyed.
+
+struct LivePayload
+{
+    static inline int live = 0;
+
+    explicit LivePayload(std::string text) : text_(std::move(text)) { live++; }
+    LivePayload(const LivePayload& payload_to_copy) : text_(payload_to_copy.text_) { live++; }
+    LivePayload(LivePayload&& payload_to_move) noexcept : text_(std::move(payload_to_move.text_)) { live++; }
+    ~LivePayload() { live--; }
+
+    LivePayload& operator=(const LivePayload&) = default;
+
+    std::string text_;
+};
+
+//  Payload whose copies and moves throw on demand, counting the payloads alive.
+
+struct ThrowingPayload
+{
+    static inline int live = 0;
+    static inline bool throw_on_move = false;
+
+    explicit ThrowingPayload(int value) : value_(value) { live++; }
+
+    ThrowingPayload(const ThrowingPayload& payload_to_copy) : value_(payload_to_copy.value_)
+    {
+        if (throw_on_move)
+        {
+            throw std::runtime_error("copy failed");
+        }
+
+        live++;
+    }
+
+    ThrowingPayload(ThrowingPayload&& payload_to_move) : value_(payload_to_move.value_)
+    {
+        if (throw_on_move)
+        {
+            throw std::runtime_error("move failed");
+        }
+
+        live++;
+    }
+
+    ~ThrowingPayload() { live--; }
+
+    ThrowingPayload& operator=(const ThrowingPayload&) = default;
+    ThrowingPayload& operator=(ThrowingPayload&&) = default;
+
+    int value_;
+};
+
+TEST_CASE("Compact Result Test", "[compact-checks]")
+{
+    {
+        AllocationCounter counter;
+
+        auto testResult1 = CompactResult<CompactErrorCodes>::success();
+        auto testResult1Copy(testResult1);
+
+        REQUIRE(counter.allocations() == 0);
+        REQUIRE(testResult1Copy.succeeded());
+        REQUIRE(!testResult1Copy.failed());
+        REQUIRE(testResult1Copy.error_code() == CompactErrorCodes::SUCCESS);
+        REQUIRE(testResult1Copy.message() == "Success");
+        REQUIRE(!testResult1Copy.inner_error());
+    }
+
+    auto testResult2 = CompactResult<CompactErrorCodes>::failure(CompactErrorCodes::FAILURE_1, "message");
+
+    REQUIRE(testResult2.failed());
+    REQUIRE(!testResult2.succeeded());
+    REQUIRE(testResult2.error_code() == CompactErrorCodes::FAILURE_1);
+    REQUIRE(testResult2.error_code_value() == 1000);
+    REQUIRE(testResult2.message() == "message");
+    REQUIRE(!testResult2.inner_error());
+
+    auto testResult3 =
+        CompactResult<CompactErrorCodes>::failure(CompactErrorCodes::FAILURE_2, "message {} {}", "test 3", 35);
+
+    REQUIRE(testResult3.failed());
+    REQUIRE(testResult3.message() == "message test 3 35");
+
+    auto innerResult = Result<CompactErrorCodes>::failure(CompactErrorCodes::FAILURE_3, "inner message");
+    auto testResult4 = CompactResult<CompactErrorCodes>::failure(innerResult, CompactErrorCodes::FAILURE_1,
+                                                                 "message {}", "test 4");
+
+    REQUIRE(testResult4.failed());
+    REQUIRE(testResult4.message() == "message test 4");
+    REQUIRE(testResult4.inner_error());
+    REQUIRE(testResult4.inner_error()->message() == "inner message");
+    REQUIRE(testResult4.inner_error()->error_code_value() == 1002);
+
+    auto testResult5 = CompactResult<CompactByteErrorCodes>::failure(testResult4, CompactByteErrorCodes::FAILURE_1,
+                                                                     "compact inner error");
+
+    REQUIRE(testResult5.inner_error());
+    REQUIRE(testResult5.inner_error()->message() == "message test 4");
+    REQUIRE(testResult5.inner_error()->inner_error());
+    REQUIRE(testResult5.inner_error()->inner_error()->message() == "inner message");
+
+    {
+        //  Copies share the failure details rather than copying the message and inner error.
+
+        AllocationCounter counter;
+
+        auto testResult4Copy(testResult4);
+
+        REQUIRE(testResult4Copy.failed());
+        REQUIRE(testResult4Copy.message() == "message test 4");
+        REQUIRE(testResult4Copy.message().data() == testResult4.message().data());
+        REQUIRE(testResult4Copy.inner_error()->message() == "inner message");
+
+        testResult2 = testResult4Copy;
+
+        const CompactResult<CompactErrorCodes>& sameResult = testResult2;
+
+        testResult2 = sameResult;
+
+        REQUIRE(counter.allocations() == 0);
+        REQUIRE(testResult2.error_code() == CompactErrorCodes::FAILURE_1);
+        REQUIRE(testResult2.message().data() == testResult4.message().data());
+        REQUIRE(testResult2.inner_error());
+    }
+
+    REQUIRE(testResult2.message() == "message test 4");
+
+    {
+        AllocationCounter counter;
+
+        auto movedResult(std::move(testResult4));
+
+        testResult3 = std::move(movedResult);
+
+        REQUIRE(counter.allocations() == 0);
+        REQUIRE(testResult3.message() == "message test 4");
+        REQUIRE(testResult3.inner_error());
+
+        //  Moved-from failures keep their code, only the message and inner error move with the details.
+
+        REQUIRE(testResult4.failed());
+        REQUIRE(testResult4.error_code() == CompactErrorCodes::FAILURE_1);
+        REQUIRE(testResult4.message().empty());
+        REQUIRE(!testResult4.inner_error());
+        REQUIRE(movedResult.failed());
+        REQUIRE(movedResult.error_code() == CompactErrorCodes::FAILURE_1);
+
+        auto converted = movedResult.to_result();
+
+        REQUIRE(converted.failed());
+        REQUIRE(converted.error_code() == CompactErrorCodes::FAILURE_1);
+        REQUIRE(converted.message().empty());
+    }
+
+    testResult2 = CompactResult<CompactErrorCodes>::success();
+
+    REQUIRE(testResult2.succeeded());
+    REQUIRE(testResult2.message() == "Success");
+}
+
+TEST_CASE("Compact Result Memory Resource Test", "[compact-checks]")
+{
+    //  The details and message of a failure come from the current result memory resource, here a buffer which
+    //      never falls back to the global heap.
+
+    alignas(std::max_align_t) std::byte buffer[1024];
+    std::pmr::monotonic_buffer_resource resource(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+
+    SEFUtility::ScopedResultMemoryResource scoped_resource(&resource);
+    AllocationCounter counter;
+
+    auto testResult1 = CompactResult<CompactErrorCodes>::failure(
+        CompactErrorCodes::FAILURE_1, "a message long enough to defeat the small string optimization {}", 1);
+    auto testResult1Copy(testResult1);
+
+    REQUIRE(counter.allocations() == 0);
+    REQUIRE(testResult1Copy.message() == "a message long enough to defeat the small string optimization 1");
+}
+
+TEST_CASE("Compact Result Conversion Test", "[compact-checks]")
+{
+    auto innerResult = Result<CompactErrorCodes>::failure(CompactErrorCodes::FAILURE_3, "inner message");
+    auto result = Result<CompactErrorCodes>::failure(innerResult, CompactErrorCodes::FAILURE_2, "outer message");
+
+    CompactResult<CompactErrorCodes> compactResult(result);
+
+    REQUIRE(compactResult.failed());
+    REQUIRE(compactResult.error_code() == CompactErrorCodes::FAILURE_2);
+    REQUIRE(compactResult.message() == "outer message");
+    REQUIRE(compactResult.inner_error()->message() == "inner message");
+
+    auto roundTrip = compactResult.to_result();
+
+    REQUIRE(roundTrip.failed());
+    REQUIRE(roundTrip.error_code() == CompactErrorCodes::FAILURE_2);
+    REQUIRE(roundTrip.message() == "outer message");
+    REQUIRE(roundTrip.inner_error());
+    REQUIRE(roundTrip.inner_error()->message() == "inner message");
+
+    auto successResult = CompactResult<CompactErrorCodes>(Result<CompactErrorCodes>::success()).to_result();
+
+    REQUIRE(successResult.succeeded());
+    REQUIRE(successResult.message() == "Success");
+}
+
+TEST_CASE("Compact Result With Return Value Test", "[compact-checks]")
+{
+    {
+        //  Successes hold the return value inline and never allocate.
+
+        AllocationCounter counter;
+
+        auto testResult1 = CompactResultWithReturnValue<CompactErrorCodes, int>::success(42);
+        auto testResult1Copy(testResult1);
+
+        REQUIRE(counter.allocations() == 0);
+        REQUIRE(testResult1Copy.succeeded());
+        REQUIRE(testResult1Copy.error_code() == CompactErrorCodes::SUCCESS);
+        REQUIRE(testResult1Copy.return_value() == 42);
+        REQUIRE(testResult1Copy.message() == "Success");
+        REQUIRE(!testResult1Copy.inner_error());
+    }
+
+    auto innerResult = Result<CompactErrorCodes>::failure(CompactErrorCodes::FAILURE_3, "inner message");
+    auto testResult2 = CompactResultWithReturnValue<CompactErrorCodes, int>::failure(
+        innerResult, CompactErrorCodes::FAILURE_1, "message {}", 2);
+
+    REQUIRE(testResult2.failed());
+    REQUIRE(testResult2.error_code() == CompactErrorCodes::FAILURE_1);
+    REQUIRE(testResult2.error_code_value() == 1000);
+    REQUIRE(testResult2.message() == "message 2");
+    REQUIRE(testResult2.inner_error()->message() == "inner message");
+
+    {
+        //  Copies of a failure share its chain node.
+
+        AllocationCounter counter;
+
+        auto testResult2Copy(testResult2);
+        auto testResult3 = CompactResultWithReturnValue<CompactErrorCodes, int>::success(3);
+
+        testResult3 = testResult2Copy;
+
+        REQUIRE(counter.allocations() == 0);
+        REQUIRE(testResult3.failed());
+        REQUIRE(testResult3.message().data() == testResult2.message().data());
+
+        auto outer = Result<CompactErrorCodes>::failure(testResult3.to_result(), CompactErrorCodes::FAILURE_2, "outer");
+
+        REQUIRE(outer.inner_error()->message() == "message 2");
+        REQUIRE(outer.inner_error()->inner_error()->message() == "inner message");
+    }
+
+    {
+        //  Exactly one member of the union is alive through every kind of copy, move and assignment.
+
+        {
+            typedef CompactResultWithReturnValue<CompactErrorCodes, LivePayload> PayloadResult;
+
+            auto success = PayloadResult::success(LivePayload("payload"));
+            auto failure = PayloadResult::failure(CompactErrorCodes::FAILURE_2, "failed");
+
+            REQUIRE(LivePayload::live == 1);
+
+            PayloadResult copy(success);
+            PayloadResult moved(std::move(copy));
+
+            REQUIRE(moved.return_value().text_ == "payload");
+
+            copy = failure;
+            moved = std::move(copy);
+
+            REQUIRE(moved.failed());
+            REQUIRE(moved.message() == "failed");
+            REQUIRE(LivePayload::live == 1);
+
+            failure = success;
+
+            REQUIRE(failure.return_value().text_ == "payload");
+            REQUIRE(LivePayload::live == 2);
+
+            LivePayload taken = std::move(failure).return_value();
+
+            REQUIRE(taken.text_ == "payload");
+        }
+
+        REQUIRE(LivePayload::live == 0);
+    }
+
+    {
+        //  A payload which throws while replacing a failure leaves the failure in place, and nothing is destroyed
+        //      twice.
+
+        {
+            typedef CompactResultWithReturnValue<CompactErrorCodes, ThrowingPayload> PayloadResult;
+
+            static_assert(!std::is_nothrow_move_assignable_v<PayloadResult>);
+
+            auto success = PayloadResult::success(std::in_place, 1);
+            auto failure = PayloadResult::failure(CompactErrorCodes::FAILURE_1, "failed");
+            auto other_success = PayloadResult::success(std::in_place, 2);
+
+            ThrowingPayload::throw_on_move = true;
+
+            REQUIRE_THROWS_AS(failure = std::move(success), std::runtime_error);
+            REQUIRE_THROWS_AS(failure = success, std::runtime_error);
+
+            REQUIRE(failure.failed());
+            REQUIRE(failure.message() == "failed");
+            REQUIRE(ThrowingPayload::live == 2);
+
+            //  Successes assign value to value, nothing is constructed.
+
+            other_success = std::move(success);
+
+            REQUIRE(other_success.return_value().value_ == 1);
+
+            ThrowingPayload::throw_on_move = false;
+
+            failure = success;
+
+            REQUIRE(failure.succeeded());
+            REQUIRE(ThrowingPayload::live == 3);
+        }
+
+        REQUIRE(ThrowingPayload::live == 0);
+    }
+
+    {
+        //  A moved-from failure converts to a failure with its code and no message.
+
+        auto failure = CompactResultWithReturnValue<CompactErrorCodes, int>::failure(innerResult,
+                                                                                    CompactErrorCodes::FAILURE_2,
+                                                                                    "failed");
+        auto moved(std::move(failure));
+
+        auto converted = failure.to_result();
+
+        REQUIRE(converted.failed());
+        REQUIRE(converted.error_code() == CompactErrorCodes::FAILURE_2);
+        REQUIRE(converted.message().empty());
+        REQUIRE(!converted.inner_error());
+        REQUIRE(moved.to_result().inner_error()->message() == "inner message");
+    }
+
+    {
+        //  Values constructed in place are neither copied nor moved.
+
+        CopyCounter counter;
+
+        auto in_place =
+            CompactResultWithReturnValue<CompactErrorCodes, CountedPayload>::success(std::in_place, 8, "eight");
+
+        REQUIRE(counter.copies() == 0);
+        REQUIRE(counter.moves() == 0);
+        REQUIRE(in_place.return_value().value() == 8);
+    }
+
+    {
+        //  Conversions to and from ResultWithReturnValue keep the value or the whole failure.
+
+        auto result = ResultWithReturnValue<CompactErrorCodes, int>::failure(innerResult, CompactErrorCodes::FAILURE_2,
+                                                                             "outer message");
+
+        CompactResultWithReturnValue<CompactErrorCodes, int> compactResult(result);
+
+        REQUIRE(compactResult.error_code() == CompactErrorCodes::FAILURE_2);
+        REQUIRE(compactResult.message() == "outer message");
+        REQUIRE(compactResult.inner_error()->message() == "inner message");
+
+        auto roundTrip = compactResult.to_result();
+
+        REQUIRE(roundTrip.failed());
+        REQUIRE(roundTrip.error_code() == CompactErrorCodes::FAILURE_2);
+        REQUIRE(roundTrip.message() == "outer message");
+        REQUIRE(roundTrip.inner_error()->message() == "inner message");
+
+        CompactResultWithReturnValue<CompactErrorCodes, int> compactSuccess(
+            ResultWithReturnValue<CompactErrorCodes, int>::success(7));
+
+        REQUIRE(compactSuccess.to_result().return_value() == 7);
+    }
+}
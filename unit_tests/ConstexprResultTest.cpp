@@ -0,0 +1,161 @@
+#include <catch2/catch_all.hpp>
+
+#include <span>
+#include <string_view>
+#include <type_traits>
+
+#include "AllocationCounter.hpp"
+#include "CPPConstexprResult.hpp"
+
+//  The pragma below is to disable to false errors flagged by intellisense for
+//  Catch2 REQUIRE macros.
+
+#if __INTELLISENSE__
+#pragma diag_suppress 2486
+#endif
+
+using SEFUtility::ConstexprErrorFrame;
+using SEFUtility::ConstexprResult;
+using SEFUtilityTest::AllocationCounter;
+
+enum class FieldErrorCodes
+{
+    SUCCESS = 0,
+    EMPTY_NAME = 1000,
+    PORT_OUT_OF_RANGE
+};
+
+enum class ConfigErrorCodes
+{
+    SUCCESS = 0,
+    INVALID_SERVICE = 2000,
+    DUPLICATE_PORT
+};
+
+struct ServiceConfig
+{
+    std::string_view name;
+    int port;
+};
+
+//  A table driven validator, evaluated at compile time below and at runtime in the test case.
+
+static constexpr ConstexprResult<FieldErrorCodes> validate_service(const ServiceConfig& service)
+{
+    if (service.name.empty())
+    {
+        return (ConstexprResult<FieldErrorCodes>::failure(FieldErrorCodes::EMPTY_NAME, "Service name is empty"));
+    }
+
+    if ((service.port <= 0) || (service.port > 65535))
+    {
+        return (ConstexprResult<FieldErrorCodes>::failure(FieldErrorCodes::PORT_OUT_OF_RANGE, "Port out of range"));
+    }
+
+    return (ConstexprResult<FieldErrorCodes>::success());
+}
+
+static constexpr ConstexprResult<ConfigErrorCodes> validate_services(std::span<const ServiceConfig> services)
+{
+    for (std::size_t i = 0; i < services.size(); i++)
+    {
+        auto service_result = validate_service(services[i]);
+
+        if (service_result.failed())
+        {
+            return (ConstexprResult<ConfigErrorCodes>::failure(service_result, ConfigErrorCodes::INVALID_SERVICE,
+                                                               "Invalid service"));
+        }
+
+        for (std::size_t j = 0; j < i; j++)
+        {
+            if (services[j].port == services[i].port)
+            {
+                return (ConstexprResult<ConfigErrorCodes>::failure(ConfigErrorCodes::DUPLICATE_PORT,
+                                                                   "Duplicate port"));
+            }
+        }
+    }
+
+    return (ConstexprResult<ConfigErrorCodes>::success());
+}
+
+static constexpr ServiceConfig VALID_SERVICES[] = {{"http", 80}, {"https", 443}, {"metrics", 9100}};
+static constexpr ServiceConfig BAD_PORT_SERVICES[] = {{"http", 80}, {"admin", 70000}};
+static constexpr ServiceConfig DUPLICATE_PORT_SERVICES[] = {{"http", 80}, {"proxy", 80}};
+
+static_assert(validate_services(VALID_SERVICES).succeeded());
+static_assert(validate_services(VALID_SERVICES).message() == "Success");
+static_assert(validate_services(BAD_PORT_SERVICES).error_code() == ConfigErrorCodes::INVALID_SERVICE);
+static_assert(validate_services(BAD_PORT_SERVICES).inner_error()->is_code(FieldErrorCodes::PORT_OUT_OF_RANGE));
+static_assert(validate_services(BAD_PORT_SERVICES).inner_error()->message() == "Port out of range");
+static_assert(validate_services(BAD_PORT_SERVICES).contains_code(FieldErrorCodes::PORT_OUT_OF_RANGE));
+static_assert(validate_services(DUPLICATE_PORT_SERVICES).error_code() == ConfigErrorCodes::DUPLICATE_PORT);
+static_assert(validate_services(DUPLICATE_PORT_SERVICES).inner_error() == nullptr);
+
+//  Results may be held in constexpr variables and are trivially copyable.
+
+static constexpr auto BAD_PORT_RESULT = validate_services(BAD_PORT_SERVICES);
+
+static_assert(BAD_PORT_RESULT.chain().size() == 2);
+static_assert(BAD_PORT_RESULT.error_domain() == SEFUtility::ErrorCodeMetadata<ConfigErrorCodes>::domain_id());
+static_assert(std::is_trivially_copyable_v<ConstexprResult<ConfigErrorCodes>>);
+static_assert(std::is_trivially_destructible_v<ConstexprResult<ConfigErrorCodes>>);
+
+//  Wrapping a chain deeper than the frames kept drops the frames just inside the root cause.
+
+static constexpr ConstexprResult<ConfigErrorCodes> wrap(std::size_t depth)
+{
+    auto result = ConstexprResult<ConfigErrorCodes>::failure(
+        ConstexprResult<FieldErrorCodes>::failure(FieldErrorCodes::EMPTY_NAME, "root cause"),
+        ConfigErrorCodes::INVALID_SERVICE, "level 1");
+
+    for (std::size_t i = 1; i < depth; i++)
+    {
+        result = ConstexprResult<ConfigErrorCodes>::failure(result, ConfigErrorCodes::INVALID_SERVICE, "wrapper");
+    }
+
+    return (result);
+}
+
+static_assert(wrap(ConstexprResult<ConfigErrorCodes>::MAX_DEPTH - 1).chain().size() ==
+              ConstexprResult<ConfigErrorCodes>::MAX_DEPTH);
+static_assert(wrap(ConstexprResult<ConfigErrorCodes>::MAX_DEPTH - 1).dropped_frames() == 0);
+static_assert(wrap(10).chain().size() == ConstexprResult<ConfigErrorCodes>::MAX_DEPTH);
+static_assert(wrap(10).dropped_frames() == 11 - ConstexprResult<ConfigErrorCodes>::MAX_DEPTH);
+static_assert(wrap(10).chain().back().message() == "root cause");
+static_assert(wrap(10).contains_code(FieldErrorCodes::EMPTY_NAME));
+
+TEST_CASE("Constexpr Result Test", "[constexpr-checks]")
+{
+    //  The same validators run at runtime without allocating.
+
+    ServiceConfig services[] = {{"http", 80}, {"", 443}};
+
+    AllocationCounter counter;
+
+    auto valid = validate_services(std::span(services, 1));
+    auto invalid = validate_services(services);
+
+    REQUIRE(counter.allocations() == 0);
+    REQUIRE(valid.succeeded());
+    REQUIRE(!valid.inner_error());
+    REQUIRE(invalid.failed());
+    REQUIRE(invalid.error_code() == ConfigErrorCodes::INVALID_SERVICE);
+    REQUIRE(invalid.error_code_value() == 2000);
+    REQUIRE(invalid.message() == "Invalid service");
+    REQUIRE(invalid.inner_error()->is_code(FieldErrorCodes::EMPTY_NAME));
+    REQUIRE(invalid.inner_error()->message() == "Service name is empty");
+    REQUIRE(!invalid.contains_code(FieldErrorCodes::PORT_OUT_OF_RANGE));
+
+    auto copy = invalid;
+
+    REQUIRE(copy.chain().size() == 2);
+    REQUIRE(copy.message().data() == invalid.message().data());
+
+    auto deep = wrap(6);
+
+    REQUIRE(deep.chain()[1].message() == "wrapper");
+    REQUIRE(deep.chain()[3].message() == "root cause");
+    REQUIRE(deep.dropped_frames() == 7 - ConstexprResult<ConfigErrorCodes>::MAX_DEPTH);
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <utility>
+
+//
+//  Payload which counts its copies and moves, to check how many times a Result copies or moves the value it
+//      returns.  A CopyCounter reports the copies and moves made by the current thread while it is in scope.
+//
+
+namespace SEFUtilityTest
+{
+    struct CopyCounts
+    {
+        std::size_t copies = 0;
+        std::size_t moves = 0;
+    };
+
+    inline thread_local CopyCounts thread_copy_counts;
+
+    class CountedPayload
+    {
+       public:
+        CountedPayload(int value, std::string text) : value_(value), text_(std::move(text)) {}
+
+        CountedPayload(const CountedPayload& payload_to_copy)
+            : value_(payload_to_copy.value_), text_(payload_to_copy.text_)
+        {
+            thread_copy_counts.copies++;
+        }
+
+        CountedPayload(CountedPayload&& payload_to_move) noexcept
+            : value_(payload_to_move.value_), text_(std::move(payload_to_move.text_))
+        {
+            thread_copy_counts.moves++;
+        }
+
+        CountedPayload& operator=(const CountedPayload& payload_to_copy)
+        {
+            value_ = payload_to_copy.value_;
+            text_ = payload_to_copy.text_;
+            thread_copy_counts.copies++;
+
+            return (*this);
+        }
+
+        CountedPayload& operator=(CountedPayload&& payload_to_move) noexcept
+        {
+            value_ = payload_to_move.value_;
+            text_ = std::move(payload_to_move.text_);
+            thread_copy_counts.moves++;
+
+            return (*this);
+        }
+
+        int value() const { return (value_); }
+
+        const std::string& text() const { return (text_); }
+
+       private:
+        int value_;
+
+        std::string text_;
+    };
+
+    class CopyCounter
+    {
+       public:
+        CopyCounter() : starting_counts_(thread_copy_counts) {}
+
+        std::size_t copies() const { return (thread_copy_counts.copies - starting_counts_.copies); }
+
+        std::size_t moves() const { return (thread_copy_counts.moves - starting_counts_.moves); }
+
+       private:
+        const CopyCounts starting_counts_;
+    };
+}  // namespace SEFUtilityTest
@@ -0,0 +1,174 @@
+#include <catch2/catch_all.hpp>
+
+#include <memory_resource>
+#include <string>
+
+#include "AllocationCounter.hpp"
+#include "CPPResultCoroutine.hpp"
+
+//  The pragma below is to disable to false errors flagged by intellisense for
+//  Catch2 REQUIRE macros.
+
+#if __INTELLISENSE__
+#pragma diag_suppress 2486
+#endif
+
+using SEFUtility::Result;
+using SEFUtility::ResultWithReturnSharedPtr;
+using SEFUtility::ResultWithReturnUniquePtr;
+using SEFUtility::ResultWithReturnValue;
+using SEFUtility::ScopedResultMemoryResource;
+using SEFUtilityTest::AllocationCounter;
+
+enum class CoroutineErrorCodes
+{
+    SUCCESS = 0,
+    NEGATIVE = 1000,
+    TOO_LARGE,
+    NOT_EVEN
+};
+
+typedef ResultWithReturnValue<CoroutineErrorCodes, int> IntResult;
+
+static IntResult parse(int value)
+{
+    if (value < 0)
+    {
+        return (IntResult::failure(CoroutineErrorCodes::NEGATIVE, "{} is negative", value));
+    }
+
+    return (IntResult::success(value));
+}
+
+static Result<CoroutineErrorCodes> check_even(int value)
+{
+    if (value % 2 != 0)
+    {
+        return (Result<CoroutineErrorCodes>::failure(CoroutineErrorCodes::NOT_EVEN, "{} is odd", value));
+    }
+
+    return (Result<CoroutineErrorCodes>::success());
+}
+
+static IntResult sum_of_halves(int first, int second, int& steps)
+{
+    int first_value = co_await parse(first);
+    steps++;
+
+    co_await check_even(first_value);
+    steps++;
+
+    int second_value = co_await parse(second);
+    steps++;
+
+    if (first_value + second_value > 100)
+    {
+        co_return IntResult::failure(CoroutineErrorCodes::TOO_LARGE, "{} is too large", first_value + second_value);
+    }
+
+    co_return (first_value + second_value) / 2;
+}
+
+static Result<CoroutineErrorCodes> validate(int value)
+{
+    co_await check_even(co_await parse(value));
+
+    co_return Result<CoroutineErrorCodes>::success();
+}
+
+TEST_CASE("Result Coroutine Test", "[coroutine-checks]")
+{
+    {
+        int steps = 0;
+        auto testResult1 = sum_of_halves(10, 20, steps);
+
+        REQUIRE(testResult1.succeeded());
+        REQUIRE(testResult1.return_value() == 15);
+        REQUIRE(steps == 3);
+    }
+
+    {
+        //  Failures return early with the awaited failure's status and message.
+
+        int steps = 0;
+        auto testResult1 = sum_of_halves(-4, 20, steps);
+
+        REQUIRE(testResult1.failed());
+        REQUIRE(testResult1.error_code() == CoroutineErrorCodes::NEGATIVE);
+        REQUIRE(testResult1.message() == "-4 is negative");
+        REQUIRE(steps == 0);
+
+        auto testResult2 = sum_of_halves(3, 20, steps);
+
+        REQUIRE(testResult2.error_code() == CoroutineErrorCodes::NOT_EVEN);
+        REQUIRE(testResult2.message() == "3 is odd");
+        REQUIRE(steps == 1);
+
+        steps = 0;
+
+        auto testResult3 = sum_of_halves(80, 40, steps);
+
+        REQUIRE(testResult3.error_code() == CoroutineErrorCodes::TOO_LARGE);
+        REQUIRE(testResult3.message() == "120 is too large");
+        REQUIRE(steps == 3);
+    }
+
+    {
+        REQUIRE(validate(4).succeeded());
+        REQUIRE(validate(5).error_code() == CoroutineErrorCodes::NOT_EVEN);
+        REQUIRE(validate(-1).error_code() == CoroutineErrorCodes::NEGATIVE);
+    }
+
+    {
+        //  Propagated failures keep their inner error chain rather than cloning it.
+
+        auto inner = Result<CoroutineErrorCodes>::failure(CoroutineErrorCodes::NEGATIVE, "root cause");
+        auto wrapped = IntResult::failure(inner, CoroutineErrorCodes::TOO_LARGE, "wrapped");
+        const SEFUtility::ResultBase* inner_node = wrapped.inner_error().get();
+
+        auto propagate = [](IntResult& awaited) -> IntResult { co_return co_await awaited; };
+
+        auto testResult1 = propagate(wrapped);
+
+        REQUIRE(testResult1.message() == "wrapped");
+        REQUIRE(testResult1.inner_error().get() == inner_node);
+        REQUIRE(wrapped.message() == "wrapped");
+    }
+
+    {
+        //  Pointer payloads are moved out of awaited rvalues.
+
+        auto make_string = []() -> ResultWithReturnValue<CoroutineErrorCodes, std::string> {
+            auto text = co_await ResultWithReturnUniquePtr<CoroutineErrorCodes, std::string>::success(
+                std::make_unique<std::string>("unique"));
+            auto shared_text = co_await ResultWithReturnSharedPtr<CoroutineErrorCodes, std::string>(
+                std::make_shared<std::string>(" shared"));
+
+            co_return *text + *shared_text;
+        };
+
+        auto testResult1 = make_string();
+
+        REQUIRE(testResult1.return_value() == "unique shared");
+    }
+
+    {
+        //  Coroutine frames come from the result memory resource.
+
+        std::pmr::unsynchronized_pool_resource resource;
+        ScopedResultMemoryResource scoped_resource(&resource);
+
+        int steps = 0;
+
+        REQUIRE(sum_of_halves(10, 20, steps).return_value() == 15);
+
+        AllocationCounter counter;
+
+        for (int i = 0; i < 16; i++)
+        {
+            REQUIRE(sum_of_halves(10, i * 2, steps).succeeded());
+        }
+
+        REQUIRE(counter.allocations() == 0);
+    }
+}
@@ -0,0 +1,165 @@
+#include <catch2/catch_all.hpp>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "CPPResultBatch.hpp"
+
+//  The pragma below is to disable to false errors flagged by intellisense for
+//  Catch2 REQUIRE macros.
+
+#if __INTELLISENSE__
+#pragma diag_suppress 2486
+#endif
+
+using SEFUtility::ErrorCodeKernels;
+using SEFUtility::Result;
+using SEFUtility::ResultBatch;
+
+enum class KernelErrorCodes
+{
+    SUCCESS = 0,
+    FAILURE_1 = 1000,
+    FAILURE_2,
+    FAILURE_3
+};
+
+enum class ShortErrorCodes : std::int16_t
+{
+    SUCCESS = 0,
+    FAILURE_1 = 100,
+    FAILURE_2
+};
+
+static std::vector<const ErrorCodeKernels::Implementation*> available_implementations()
+{
+    std::vector<const ErrorCodeKernels::Implementation*> implementations{&ErrorCodeKernels::scalar()};
+
+    if (ErrorCodeKernels::sse2() != nullptr)
+    {
+        implementations.push_back(ErrorCodeKernels::sse2());
+    }
+
+    if (ErrorCodeKernels::avx2() != nullptr)
+    {
+        implementations.push_back(ErrorCodeKernels::avx2());
+    }
+
+    return (implementations);
+}
+
+TEST_CASE("Error Code Kernels Test", "[kernel-checks]")
+{
+    {
+        //  Every implementation agrees with the scalar one, including sizes which leave a partial vector and
+        //      arrays starting off a vector boundary.
+
+        std::mt19937 generator(12345);
+        std::uniform_int_distribution<int> distribution(0, 3);
+
+        const ErrorCodeKernels::Implementation& scalar = ErrorCodeKernels::scalar();
+
+        for (std::size_t size : {0, 1, 3, 4, 7, 8, 9, 31, 32, 33, 63, 100, 1000})
+        {
+            std::vector<std::int32_t> codes(size + 1, 0);
+
+            for (std::size_t i = 0; i < codes.size(); i++)
+            {
+                codes[i] = (distribution(generator) == 0) ? 1000 + distribution(generator) : 0;
+            }
+
+            for (const ErrorCodeKernels::Implementation* implementation : available_implementations())
+            {
+                for (const std::int32_t* first : {codes.data(), codes.data() + 1})
+                {
+                    for (std::int32_t value : {0, 1000, 1001, 1003, 7})
+                    {
+                        REQUIRE(implementation->find_first_not_equal_(first, size, value) ==
+                                scalar.find_first_not_equal_(first, size, value));
+                        REQUIRE(implementation->count_equal_(first, size, value) ==
+                                scalar.count_equal_(first, size, value));
+
+                        std::vector<std::size_t> indices;
+                        std::vector<std::size_t> scalar_indices;
+
+                        implementation->collect_equal_(first, size, value, indices);
+                        scalar.collect_equal_(first, size, value, scalar_indices);
+
+                        REQUIRE(indices == scalar_indices);
+                    }
+                }
+            }
+        }
+    }
+
+    {
+        //  A lone mismatch is found wherever it falls.
+
+        std::vector<std::int32_t> codes(200, 0);
+
+        for (const ErrorCodeKernels::Implementation* implementation : available_implementations())
+        {
+            for (std::size_t position = 0; position < codes.size(); position++)
+            {
+                codes[position] = 1000;
+
+                REQUIRE(implementation->find_first_not_equal_(codes.data(), codes.size(), 0) == position);
+                REQUIRE(implementation->count_equal_(codes.data(), codes.size(), 1000) == 1);
+
+                codes[position] = 0;
+            }
+
+            REQUIRE(implementation->find_first_not_equal_(codes.data(), codes.size(), 0) == codes.size());
+        }
+
+        REQUIRE(!ErrorCodeKernels::any_not_equal(codes.data(), codes.size(), 0));
+    }
+}
+
+TEST_CASE("Result Batch Scan Test", "[kernel-checks]")
+{
+    {
+        ResultBatch<KernelErrorCodes> batch(300);
+
+        REQUIRE(batch.first_failure() == 300);
+        REQUIRE(batch.count_error_code(KernelErrorCodes::SUCCESS) == 300);
+        REQUIRE(batch.count_error_code(KernelErrorCodes::FAILURE_1) == 0);
+        REQUIRE(batch.indices_with_error_code(KernelErrorCodes::SUCCESS).size() == 300);
+        REQUIRE(batch.indices_with_error_code(KernelErrorCodes::FAILURE_1).empty());
+        REQUIRE(batch.error_code_histogram().empty());
+
+        batch.set(250, Result<KernelErrorCodes>::failure(KernelErrorCodes::FAILURE_2, "two"));
+        batch.set(70, Result<KernelErrorCodes>::failure(KernelErrorCodes::FAILURE_1, "one"));
+        batch.set(130, Result<KernelErrorCodes>::failure(KernelErrorCodes::FAILURE_1, "one"));
+
+        REQUIRE(batch.first_failure() == 70);
+        REQUIRE(batch.count_error_code(KernelErrorCodes::SUCCESS) == 297);
+        REQUIRE(batch.count_error_code(KernelErrorCodes::FAILURE_1) == 2);
+        REQUIRE(batch.indices_with_error_code(KernelErrorCodes::FAILURE_1) == std::vector<std::size_t>{70, 130});
+        REQUIRE(batch.indices_with_error_code(KernelErrorCodes::FAILURE_3).empty());
+
+        auto histogram = batch.error_code_histogram();
+
+        REQUIRE(histogram.size() == 2);
+        REQUIRE(histogram[0] == std::make_pair(KernelErrorCodes::FAILURE_1, std::size_t(2)));
+        REQUIRE(histogram[1] == std::make_pair(KernelErrorCodes::FAILURE_2, std::size_t(1)));
+
+        batch.set_success(70);
+
+        REQUIRE(batch.first_failure() == 130);
+    }
+
+    {
+        //  Error codes other than 32 bits wide fall back to scalar loops.
+
+        ResultBatch<ShortErrorCodes> batch(50);
+
+        batch.set(9, Result<ShortErrorCodes>::failure(ShortErrorCodes::FAILURE_2, "two"));
+        batch.set(40, Result<ShortErrorCodes>::failure(ShortErrorCodes::FAILURE_2, "two"));
+
+        REQUIRE(batch.first_failure() == 9);
+        REQUIRE(batch.count_error_code(ShortErrorCodes::FAILURE_2) == 2);
+        REQUIRE(batch.indices_with_error_code(ShortErrorCodes::FAILURE_2) == std::vector<std::size_t>{9, 40});
+    }
+}
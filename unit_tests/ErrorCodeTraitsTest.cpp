@@ -0,0 +1,149 @@
+#include <catch2/catch_all.hpp>
+
+#include "AllocationCounter.hpp"
+#include "CPPCompactResult.hpp"
+#include "CPPResult.hpp"
+
+//  The pragma below is to disable to false errors flagged by intellisense for
+//  Catch2 REQUIRE macros.
+
+#if __INTELLISENSE__
+#pragma diag_suppress 2486
+#endif
+
+using SEFUtility::CompactResult;
+using SEFUtility::ErrorCodeMetadata;
+using SEFUtility::ErrorSeverity;
+using SEFUtility::Result;
+using SEFUtility::ResultBase;
+using SEFUtility::ResultWithReturnValue;
+using SEFUtilityTest::AllocationCounter;
+
+namespace TraitsTest
+{
+    enum class DatabaseErrors
+    {
+        SUCCESS = 0,
+        TIMEOUT = 1000,
+        CORRUPT,
+        LOCKED
+    };
+}
+
+enum class SparseErrors
+{
+    SUCCESS = 0,
+    MINOR = 5,
+    MAJOR = 500
+};
+
+enum class UndescribedErrors
+{
+    SUCCESS = 0,
+    FAILURE_1 = 1000
+};
+
+template <>
+struct SEFUtility::ErrorCodeTraits<TraitsTest::DatabaseErrors>
+{
+    static constexpr ErrorCodeDescription codes[] = {
+        CPPRESULT_ERROR_CODE(TraitsTest::DatabaseErrors::CORRUPT, ErrorSeverity::CRITICAL),
+        CPPRESULT_ERROR_CODE(TraitsTest::DatabaseErrors::TIMEOUT, ErrorSeverity::WARNING, true),
+        CPPRESULT_ERROR_CODE(TraitsTest::DatabaseErrors::LOCKED, ErrorSeverity::FAILURE, true)};
+};
+
+template <>
+struct SEFUtility::ErrorCodeTraits<SparseErrors>
+{
+    static constexpr std::string_view name = "Sparse";
+
+    static constexpr ErrorCodeDescription codes[] = {CPPRESULT_ERROR_CODE(SparseErrors::MAJOR),
+                                                     CPPRESULT_ERROR_CODE(SparseErrors::MINOR, ErrorSeverity::WARNING)};
+};
+
+//  An enum whose compiler name, and so whose error domain, matches the enum of the same name in an anonymous
+//      namespace of ResultTest.cpp.
+
+namespace
+{
+    enum class SameNamedErrors
+    {
+        SUCCESS = 0,
+        FAILURE_1 = 1000
+    };
+}  // namespace
+
+SEFUtility::InnerErrorPtr same_named_domain_failure()
+{
+    return (Result<SameNamedErrors>::failure(SameNamedErrors::FAILURE_1, "other translation unit").as_inner_error());
+}
+
+//  The tables are resolved at compile time.
+
+static_assert(SEFUtility::error_code_name(TraitsTest::DatabaseErrors::TIMEOUT) == "TIMEOUT");
+static_assert(SEFUtility::is_retryable(TraitsTest::DatabaseErrors::LOCKED));
+static_assert(ErrorCodeMetadata<TraitsTest::DatabaseErrors>::severity(TraitsTest::DatabaseErrors::CORRUPT) ==
+              ErrorSeverity::CRITICAL);
+static_assert(ErrorCodeMetadata<SparseErrors>::name(SparseErrors::MINOR) == "MINOR");
+static_assert(CompactResult<SparseErrors>::success().error_code_name() == "SUCCESS");
+
+TEST_CASE("Error Code Traits Test", "[traits-checks]")
+{
+    {
+        REQUIRE(ErrorCodeMetadata<TraitsTest::DatabaseErrors>::enum_name() == "TraitsTest::DatabaseErrors");
+        REQUIRE(ErrorCodeMetadata<SparseErrors>::enum_name() == "Sparse");
+        REQUIRE(ErrorCodeMetadata<UndescribedErrors>::enum_name() == "UndescribedErrors");
+
+        REQUIRE(ErrorCodeMetadata<TraitsTest::DatabaseErrors>::size() == 3);
+        REQUIRE(ErrorCodeMetadata<SparseErrors>::name(SparseErrors::MAJOR) == "MAJOR");
+        REQUIRE(ErrorCodeMetadata<SparseErrors>::name(SparseErrors::SUCCESS) == "SUCCESS");
+        REQUIRE(ErrorCodeMetadata<SparseErrors>::severity(SparseErrors::SUCCESS) == ErrorSeverity::NONE);
+
+        //  Codes missing from the traits are unnamed, non-retryable failures.
+
+        REQUIRE(ErrorCodeMetadata<SparseErrors>::name(SparseErrors(6)).empty());
+        REQUIRE(
+            ErrorCodeMetadata<TraitsTest::DatabaseErrors>::describe(TraitsTest::DatabaseErrors(2000)).name().empty());
+        REQUIRE(ErrorCodeMetadata<UndescribedErrors>::severity(UndescribedErrors::FAILURE_1) == ErrorSeverity::FAILURE);
+        REQUIRE(!ErrorCodeMetadata<UndescribedErrors>::retryable(UndescribedErrors::FAILURE_1));
+    }
+
+    {
+        //  Results and their inner errors describe themselves without RTTI or allocation.
+
+        auto inner = Result<TraitsTest::DatabaseErrors>::failure(TraitsTest::DatabaseErrors::TIMEOUT, "timed out");
+        auto outer = ResultWithReturnValue<SparseErrors, int>::failure(inner, SparseErrors::MAJOR, "query failed");
+
+        AllocationCounter counter;
+
+        REQUIRE(inner.error_code_name() == "TIMEOUT");
+        REQUIRE(inner.retryable());
+        REQUIRE(!outer.retryable());
+        REQUIRE(outer.error_code_name() == "MAJOR");
+        REQUIRE(outer.error_code_enum_name() == "Sparse");
+
+        const ResultBase& inner_error = *outer.inner_error();
+
+        REQUIRE(inner_error.error_code_name() == "TIMEOUT");
+        REQUIRE(inner_error.error_code_enum_name() == "TraitsTest::DatabaseErrors");
+        REQUIRE(inner_error.error_code_description().severity() == ErrorSeverity::WARNING);
+        REQUIRE(inner_error.retryable());
+
+        REQUIRE(counter.allocations() == 0);
+    }
+
+    {
+        //  Successes are never retryable.
+
+        auto testResult1 = Result<TraitsTest::DatabaseErrors>::success();
+
+        REQUIRE(testResult1.error_code_name() == "SUCCESS");
+        REQUIRE(!testResult1.retryable());
+
+        auto testResult2 =
+            CompactResult<TraitsTest::DatabaseErrors>::failure(TraitsTest::DatabaseErrors::LOCKED, "locked");
+
+        REQUIRE(testResult2.error_code_name() == "LOCKED");
+        REQUIRE(testResult2.retryable());
+    }
+}
@@ -0,0 +1,140 @@
+#include <catch2/catch_all.hpp>
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include "AllocationCounter.hpp"
+#include "CPPResult.hpp"
+
+//  The pragma below is to disable to false errors flagged by intellisense for
+//  Catch2 REQUIRE macros.
+
+#if __INTELLISENSE__
+#pragma diag_suppress 2486
+#endif
+
+using SEFUtility::ErrorCodeMetadata;
+using SEFUtility::FailureCount;
+using SEFUtility::FailureCounters;
+using SEFUtility::Result;
+using SEFUtility::ResultWithReturnValue;
+using SEFUtilityTest::AllocationCounter;
+
+using namespace SEFUtility::literals;
+
+enum class CountedErrorCodes
+{
+    SUCCESS = 0,
+    FAILURE_1 = 1000,
+    FAILURE_2,
+    FAILURE_3
+};
+
+#if defined(CPPRESULT_ENABLE_INSTRUMENTATION)
+static std::uint64_t snapshot_count(const std::vector<FailureCount>& counts, CountedErrorCodes error_code)
+{
+    for (const FailureCount& entry : counts)
+    {
+        if ((entry.error_domain == ErrorCodeMetadata<CountedErrorCodes>::domain_id()) &&
+            (entry.error_code_value == int(error_code)))
+        {
+            return (entry.count);
+        }
+    }
+
+    return (0);
+}
+#endif
+
+TEST_CASE("Failure Counters Test", "[instrumentation-checks]")
+{
+    {
+        //  Counters may be fed directly, whether or not failures count themselves.
+
+        std::uint64_t starting_count = FailureCounters::count(CountedErrorCodes::FAILURE_3);
+
+        AllocationCounter counter;
+
+        const SEFUtility::ErrorDomainId domain = ErrorCodeMetadata<CountedErrorCodes>::domain_id();
+
+        for (int i = 0; i < 10; i++)
+        {
+            FailureCounters::record(domain, int(CountedErrorCodes::FAILURE_3));
+        }
+
+        REQUIRE(counter.allocations() == 0);
+        REQUIRE(FailureCounters::count(CountedErrorCodes::FAILURE_3) == starting_count + 10);
+    }
+
+#if defined(CPPRESULT_ENABLE_INSTRUMENTATION)
+    {
+        //  Each failure is counted once when it is created, successes, copies and chain nodes are not counted.
+
+        std::uint64_t starting_count1 = FailureCounters::count(CountedErrorCodes::FAILURE_1);
+        std::uint64_t starting_count2 = FailureCounters::count(CountedErrorCodes::FAILURE_2);
+
+        auto testResult1 = Result<CountedErrorCodes>::failure(CountedErrorCodes::FAILURE_1, "first");
+        auto testResult2 = ResultWithReturnValue<CountedErrorCodes, int>::failure(testResult1,
+                                                                                  CountedErrorCodes::FAILURE_2,
+                                                                                  "second {}", 2);
+        auto testResult3 = Result<CountedErrorCodes>::failure(CountedErrorCodes::FAILURE_1, "third"_msg);
+        auto testResult4 = Result<CountedErrorCodes>::success();
+        auto copy = testResult2;
+
+        REQUIRE(FailureCounters::count(CountedErrorCodes::FAILURE_1) == starting_count1 + 2);
+        REQUIRE(FailureCounters::count(CountedErrorCodes::FAILURE_2) == starting_count2 + 1);
+        REQUIRE(FailureCounters::count(CountedErrorCodes::SUCCESS) == 0);
+
+        auto counts = FailureCounters::snapshot();
+
+        REQUIRE(snapshot_count(counts, CountedErrorCodes::FAILURE_1) == starting_count1 + 2);
+        REQUIRE(std::is_sorted(counts.begin(), counts.end(), [](const FailureCount& first, const FailureCount& second) {
+            return ((first.error_domain < second.error_domain) ||
+                    ((first.error_domain == second.error_domain) &&
+                     (first.error_code_value < second.error_code_value)));
+        }));
+    }
+
+    {
+        //  Counts from every thread are merged, including threads which have exited, while snapshots are
+        //      taken concurrently.
+
+        constexpr int NUMBER_OF_THREADS = 8;
+        constexpr int FAILURES_PER_THREAD = 2000;
+
+        std::uint64_t starting_count = FailureCounters::count(CountedErrorCodes::FAILURE_2);
+
+        std::vector<std::thread> threads;
+
+        for (int i = 0; i < NUMBER_OF_THREADS; i++)
+        {
+            threads.emplace_back([]() {
+                for (int j = 0; j < FAILURES_PER_THREAD; j++)
+                {
+                    auto failure = Result<CountedErrorCodes>::failure(CountedErrorCodes::FAILURE_2, "failure"_msg);
+                }
+            });
+        }
+
+        std::uint64_t previous_count = starting_count;
+
+        for (int i = 0; i < 100; i++)
+        {
+            std::uint64_t current_count = snapshot_count(FailureCounters::snapshot(), CountedErrorCodes::FAILURE_2);
+
+            REQUIRE(current_count >= previous_count);
+            previous_count = current_count;
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        REQUIRE(FailureCounters::count(CountedErrorCodes::FAILURE_2) ==
+                starting_count + NUMBER_OF_THREADS * FAILURES_PER_THREAD);
+        REQUIRE(FailureCounters::untracked() == 0);
+    }
+#endif
+}
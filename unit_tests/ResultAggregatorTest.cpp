@@ -0,0 +1,180 @@
+#include <catch2/catch_all.hpp>
+
+#include <atomic>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "CPPResultAggregator.hpp"
+
+//  The pragma below is to disable to false errors flagged by intellisense for
+//  Catch2 REQUIRE macros.
+
+#if __INTELLISENSE__
+#pragma diag_suppress 2486
+#endif
+
+using SEFUtility::FailureCollector;
+using SEFUtility::FirstFailureLatch;
+using SEFUtility::InnerErrorPtr;
+using SEFUtility::Result;
+using SEFUtility::ResultWithReturnValue;
+
+enum class JobErrorCodes
+{
+    SUCCESS = 0,
+    TASK_FAILED = 1000,
+    JOB_FAILED
+};
+
+typedef ResultWithReturnValue<JobErrorCodes, int> TaskResult;
+
+static TaskResult run_task(int task)
+{
+    if (task % 100 == 7)
+    {
+        return (TaskResult::failure(JobErrorCodes::TASK_FAILED, "Task {} failed", task));
+    }
+
+    return (TaskResult::success(task));
+}
+
+TEST_CASE("Result Aggregator Test", "[aggregator-checks]")
+{
+    {
+        //  Successes are ignored, the first failure is kept and the rest are counted.
+
+        FirstFailureLatch latch;
+
+        REQUIRE(!latch.offer(run_task(1)));
+        REQUIRE(!latch.failed());
+        REQUIRE(latch.reduce(JobErrorCodes::JOB_FAILED, "job failed").succeeded());
+
+        REQUIRE(latch.offer(run_task(7)));
+        REQUIRE(!latch.offer(run_task(107)));
+        REQUIRE(latch.failed());
+        REQUIRE(latch.failure_count() == 2);
+        REQUIRE(latch.first_failure()->message() == "Task 7 failed");
+
+        auto job = latch.reduce(JobErrorCodes::JOB_FAILED, "job failed");
+
+        REQUIRE(job.error_code() == JobErrorCodes::JOB_FAILED);
+        REQUIRE(job.inner_error().get() == latch.first_failure());
+    }
+
+    {
+        //  The collector keeps failures up to its capacity, kept failures outlive it.
+
+        InnerErrorPtr kept_failure;
+        Result<JobErrorCodes> job = Result<JobErrorCodes>::success();
+
+        {
+            FailureCollector collector(2);
+
+            REQUIRE(!collector.offer(run_task(3)));
+            REQUIRE(collector.offer(run_task(7)));
+            REQUIRE(collector.offer(run_task(207)));
+            REQUIRE(!collector.offer(run_task(307)));
+
+            REQUIRE(collector.failure_count() == 3);
+            REQUIRE(collector.failures().size() == 2);
+            REQUIRE(collector.failures()[1]->message() == "Task 207 failed");
+
+            kept_failure = collector.failures()[0];
+            job = collector.reduce(JobErrorCodes::JOB_FAILED, "job failed");
+        }
+
+        REQUIRE(kept_failure->message() == "Task 7 failed");
+        REQUIRE(job.inner_error().get() == kept_failure.get());
+        REQUIRE(job.causes().size() == 2);
+        REQUIRE(job.causes()[1]->message() == "Task 207 failed");
+
+        FailureCollector empty_collector(4);
+
+        REQUIRE(empty_collector.reduce(JobErrorCodes::JOB_FAILED, "job failed").succeeded());
+        REQUIRE(empty_collector.failures().empty());
+    }
+}
+
+TEST_CASE("Result Aggregator Stress Test", "[aggregator-checks]")
+{
+    constexpr int NUMBER_OF_THREADS = 16;
+    constexpr int TASKS_PER_THREAD = 5000;
+    constexpr std::size_t CAPACITY = 300;
+
+    for (int round = 0; round < 5; round++)
+    {
+        FirstFailureLatch latch;
+        FailureCollector collector(CAPACITY);
+        std::atomic<int> latch_winners = 0;
+        std::atomic<bool> finished = false;
+        std::atomic<int> bad_reads = 0;
+
+        //  A reader looks at the kept failures while the workers are still offering results, Catch2 assertions
+        //      are not thread safe so it only counts what it finds wrong.
+
+        std::thread reader([&]() {
+            while (!finished.load())
+            {
+                for (const InnerErrorPtr& failure : collector.failures())
+                {
+                    bad_reads += failure->message().starts_with("Task ") ? 0 : 1;
+                }
+
+                if (latch.failed())
+                {
+                    bad_reads += latch.first_failure()->error_code_value() == int(JobErrorCodes::TASK_FAILED) ? 0 : 1;
+                }
+            }
+        });
+
+        std::vector<std::thread> workers;
+
+        for (int i = 0; i < NUMBER_OF_THREADS; i++)
+        {
+            workers.emplace_back([&, i]() {
+                for (int task = i * TASKS_PER_THREAD; task < (i + 1) * TASKS_PER_THREAD; task++)
+                {
+                    TaskResult result = run_task(task);
+
+                    latch_winners += latch.offer(result) ? 1 : 0;
+                    collector.offer(result);
+                }
+            });
+        }
+
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+
+        finished = true;
+        reader.join();
+
+        const std::size_t expected_failures = NUMBER_OF_THREADS * TASKS_PER_THREAD / 100;
+
+        REQUIRE(bad_reads == 0);
+        REQUIRE(latch_winners == 1);
+        REQUIRE(latch.failure_count() == expected_failures);
+        REQUIRE(collector.failure_count() == expected_failures);
+
+        //  Each kept failure is a distinct task.
+
+        std::vector<InnerErrorPtr> failures = collector.failures();
+        std::set<std::string_view> messages;
+
+        for (const InnerErrorPtr& failure : failures)
+        {
+            messages.insert(failure->message());
+        }
+
+        REQUIRE(failures.size() == CAPACITY);
+        REQUIRE(messages.size() == CAPACITY);
+
+        auto job = collector.reduce(JobErrorCodes::JOB_FAILED, "tasks failed");
+
+        REQUIRE(job.failed());
+        REQUIRE(job.inner_error().get() == failures[0].get());
+        REQUIRE(job.causes().size() == CAPACITY);
+    }
+}
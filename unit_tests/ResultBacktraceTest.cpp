@@ -0,0 +1,142 @@
+#include <catch2/catch_all.hpp>
+
+#include <string>
+
+#include "CPPResult.hpp"
+
+//  The pragma below is to disable to false errors flagged by intellisense for
+//  Catch2 REQUIRE macros.
+
+#if __INTELLISENSE__
+#pragma diag_suppress 2486
+#endif
+
+using SEFUtility::FailureBacktrace;
+using SEFUtility::Result;
+using SEFUtility::ResultWithReturnUniquePtr;
+using SEFUtility::ResultWithReturnValue;
+
+using namespace SEFUtility::literals;
+
+enum class BacktraceErrorCodes
+{
+    SUCCESS = 0,
+    FAILURE_1 = 1000,
+    FAILURE_2
+};
+
+static bool located_in_this_file(const SEFUtility::ResultBase& result)
+{
+    return (std::string(result.location().file_name()).ends_with("ResultBacktraceTest.cpp"));
+}
+
+TEST_CASE("Result Source Location Test", "[location-checks]")
+{
+    {
+        //  Each kind of failure factory records the line it was called from.
+
+        unsigned int line = __LINE__ + 1;
+        auto testResult1 = Result<BacktraceErrorCodes>::failure(BacktraceErrorCodes::FAILURE_1, "plain");
+
+        REQUIRE(testResult1.location().line() == line);
+        REQUIRE(located_in_this_file(testResult1));
+
+        line = __LINE__ + 1;
+        auto testResult2 = ResultWithReturnValue<BacktraceErrorCodes, int>::failure(BacktraceErrorCodes::FAILURE_2,
+                                                                                     "formatted {}", 7);
+
+        REQUIRE(testResult2.location().line() == line);
+        REQUIRE(testResult2.message() == "formatted 7");
+
+        line = __LINE__ + 1;
+        auto testResult3 = Result<BacktraceErrorCodes>::failure(BacktraceErrorCodes::FAILURE_1, "static"_msg);
+
+        REQUIRE(testResult3.location().line() == line);
+        REQUIRE(located_in_this_file(testResult3));
+
+        line = __LINE__ + 1;
+        auto testResult4 = Result<BacktraceErrorCodes>::lazy_failure(BacktraceErrorCodes::FAILURE_1, "lazy {}", 3);
+
+        REQUIRE(testResult4.location().line() == line);
+        REQUIRE(testResult4.message() == "lazy 3");
+
+        line = __LINE__ + 1;
+        auto testResult5 = ResultWithReturnUniquePtr<BacktraceErrorCodes, int>::failure(testResult1,
+                                                                                         BacktraceErrorCodes::FAILURE_2,
+                                                                                         "outer");
+
+        REQUIRE(testResult5.location().line() == line);
+    }
+
+    {
+        //  Inner error chain nodes and copies keep the location of the original failure.
+
+        unsigned int line = __LINE__ + 1;
+        auto inner = Result<BacktraceErrorCodes>::failure(BacktraceErrorCodes::FAILURE_1, "inner");
+        auto outer = Result<BacktraceErrorCodes>::failure(inner, BacktraceErrorCodes::FAILURE_2, "outer");
+
+        REQUIRE(outer.inner_error()->location().line() == line);
+        REQUIRE(outer.location().line() == line + 1);
+
+        auto copy = outer;
+        auto moved = std::move(copy);
+
+        REQUIRE(moved.location().line() == line + 1);
+        REQUIRE(located_in_this_file(moved));
+    }
+}
+
+TEST_CASE("Result Backtrace Sampling Test", "[backtrace-checks]")
+{
+    {
+        //  Capture is off by default.
+
+        REQUIRE(FailureBacktrace::get_sampling_interval() == 0);
+
+        auto testResult1 = Result<BacktraceErrorCodes>::failure(BacktraceErrorCodes::FAILURE_1, "not sampled");
+
+        REQUIRE(!testResult1.backtrace());
+    }
+
+#if defined(CPPRESULT_HAS_EXECINFO)
+    {
+        FailureBacktrace::set_sampling_interval(1);
+
+        auto testResult1 = Result<BacktraceErrorCodes>::failure(BacktraceErrorCodes::FAILURE_1, "sampled");
+        auto testResult2 = Result<BacktraceErrorCodes>::success();
+
+        //  Successes never capture a backtrace.
+
+        REQUIRE(testResult1.backtrace());
+        REQUIRE(!testResult2.backtrace());
+        REQUIRE(!testResult1.backtrace()->frames().empty());
+        REQUIRE(!testResult1.backtrace()->symbolize().empty());
+
+        //  Copies and chain nodes share the backtrace.
+
+        auto copy = testResult1;
+        auto outer = Result<BacktraceErrorCodes>::failure(testResult1, BacktraceErrorCodes::FAILURE_2, "outer");
+
+        REQUIRE(copy.backtrace().get() == testResult1.backtrace().get());
+        REQUIRE(outer.inner_error()->backtrace().get() == testResult1.backtrace().get());
+        REQUIRE(outer.backtrace().get() != testResult1.backtrace().get());
+    }
+
+    {
+        FailureBacktrace::set_sampling_interval(4);
+
+        int sampled = 0;
+
+        for (int i = 0; i < 100; i++)
+        {
+            auto testResult1 = Result<BacktraceErrorCodes>::failure(BacktraceErrorCodes::FAILURE_1, "failure {}", i);
+
+            sampled += testResult1.backtrace() ? 1 : 0;
+        }
+
+        REQUIRE(sampled == 25);
+    }
+
+    FailureBacktrace::set_sampling_interval(0);
+#endif
+}
@@ -0,0 +1,324 @@
+#include <catch2/catch_all.hpp>
+
+#include <memory_resource>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "AllocationCounter.hpp"
+#include "CPPResultBatch.hpp"
+
+//  The pragma below is to disable to false errors flagged by intellisense for
+//  Catch2 REQUIRE macros.
+
+#if __INTELLISENSE__
+#pragma diag_suppress 2486
+#endif
+
+using SEFUtility::Result;
+using SEFUtility::ResultBatch;
+using SEFUtility::ResultSet;
+using SEFUtility::ResultWithReturnValue;
+using SEFUtility::ScopedResultMemoryResource;
+using SEFUtilityTest::AllocationCounter;
+
+enum class BatchErrorCodes
+{
+    SUCCESS = 0,
+    FAILURE_1 = 1000,
+    FAILURE_2,
+    FAILURE_3
+};
+
+//  Return value which counts its copies, so tests can check that values are moved rather than copied.
+
+struct CopyCountedValue
+{
+    CopyCountedValue() = default;
+
+    explicit CopyCountedValue(int value) : value_(value) {}
+
+    CopyCountedValue(const CopyCountedValue& value_to_copy) : value_(value_to_copy.value_) { copies++; }
+
+    CopyCountedValue(CopyCountedValue&& value_to_move) noexcept = default;
+
+    CopyCountedValue& operator=(const CopyCountedValue& value_to_copy)
+    {
+        value_ = value_to_copy.value_;
+        copies++;
+
+        return (*this);
+    }
+
+    CopyCountedValue& operator=(CopyCountedValue&& value_to_move) noexcept = default;
+
+    static inline std::size_t copies = 0;
+
+    int value_ = 0;
+};
+
+TEST_CASE("Result Batch Test", "[batch-checks]")
+{
+    {
+        //  A batch of successes never allocates.
+
+        ScopedResultMemoryResource heap_resource(std::pmr::new_delete_resource());
+        AllocationCounter counter;
+
+        ResultBatch<BatchErrorCodes> batch(10000);
+
+        for (std::size_t i = 0; i < batch.size(); i++)
+        {
+            batch.set(i, Result<BatchErrorCodes>::success());
+        }
+
+        REQUIRE(counter.allocations() == 0);
+        REQUIRE(batch.all_succeeded());
+        REQUIRE(batch.count_failed() == 0);
+        REQUIRE(batch.count_succeeded() == 10000);
+        REQUIRE(batch.succeeded(9999));
+        REQUIRE(batch.error_code(5000) == BatchErrorCodes::SUCCESS);
+        REQUIRE(batch.message(5000) == "Success");
+    }
+
+    {
+        ResultBatch<BatchErrorCodes> batch(200);
+
+        auto inner = Result<BatchErrorCodes>::failure(BatchErrorCodes::FAILURE_3, "inner");
+
+        batch.set(130, Result<BatchErrorCodes>::failure(BatchErrorCodes::FAILURE_2, "failure {}", 130));
+        batch.set(3, Result<BatchErrorCodes>::failure(inner, BatchErrorCodes::FAILURE_1, "failure 3"));
+        batch.set(64, Result<BatchErrorCodes>::failure(BatchErrorCodes::FAILURE_1, "failure 64"));
+
+        REQUIRE(!batch.all_succeeded());
+        REQUIRE(batch.count_failed() == 3);
+        REQUIRE(batch.failed(3));
+        REQUIRE(batch.failed(64));
+        REQUIRE(batch.failed(130));
+        REQUIRE(batch.succeeded(63));
+        REQUIRE(batch.error_code(130) == BatchErrorCodes::FAILURE_2);
+        REQUIRE(batch.error_code(131) == BatchErrorCodes::SUCCESS);
+        REQUIRE(batch.message(130) == "failure 130");
+
+        //  Failures are visited in index order.
+
+        std::vector<std::size_t> indices;
+
+        batch.for_each_failure([&indices](std::size_t index, const Result<BatchErrorCodes>& failure) {
+            indices.push_back(index);
+            REQUIRE(failure.failed());
+        });
+
+        REQUIRE(indices == std::vector<std::size_t>{3, 64, 130});
+
+        //  Converting back shares the stored inner error chain.
+
+        auto testResult1 = batch.result(3);
+
+        REQUIRE(testResult1.error_code() == BatchErrorCodes::FAILURE_1);
+        REQUIRE(testResult1.message() == "failure 3");
+        REQUIRE(testResult1.inner_error()->message() == "inner");
+        REQUIRE(batch.result(4).succeeded());
+
+        //  Outcomes may be replaced.
+
+        batch.set(64, Result<BatchErrorCodes>::failure(BatchErrorCodes::FAILURE_3, "replaced"));
+
+        REQUIRE(batch.count_failed() == 3);
+        REQUIRE(batch.error_code(64) == BatchErrorCodes::FAILURE_3);
+        REQUIRE(batch.message(64) == "replaced");
+
+        batch.set(64, Result<BatchErrorCodes>::success());
+        batch.set_success(3);
+
+        REQUIRE(batch.count_failed() == 1);
+        REQUIRE(batch.succeeded(64));
+        REQUIRE(batch.error_code(3) == BatchErrorCodes::SUCCESS);
+        REQUIRE(batch.message(130) == "failure 130");
+
+        auto batch_copy(batch);
+
+        REQUIRE(batch_copy.count_failed() == 1);
+        REQUIRE(batch_copy.result(130).message() == "failure 130");
+    }
+
+    {
+        //  Moving a batch leaves the source empty, and move assigning between batches allocated from different
+        //      resources takes the storage rather than copying it.
+
+        std::pmr::unsynchronized_pool_resource source_resource;
+        std::pmr::unsynchronized_pool_resource target_resource;
+
+        std::optional<ResultBatch<BatchErrorCodes>> source;
+        std::optional<ResultBatch<BatchErrorCodes>> target;
+
+        {
+            ScopedResultMemoryResource scoped_resource(&source_resource);
+
+            source.emplace(100);
+            source->set(42, Result<BatchErrorCodes>::failure(BatchErrorCodes::FAILURE_1, "failure 42"));
+        }
+
+        {
+            ScopedResultMemoryResource scoped_resource(&target_resource);
+
+            target.emplace(10);
+            target->set(1, Result<BatchErrorCodes>::failure(BatchErrorCodes::FAILURE_2, "failure 1"));
+        }
+
+        const std::uint64_t* failure_bits = source->failure_bits();
+
+        *target = std::move(*source);
+
+        REQUIRE(target->size() == 100);
+        REQUIRE(target->count_failed() == 1);
+        REQUIRE(target->failure_bits() == failure_bits);
+        REQUIRE(target->message(42) == "failure 42");
+        REQUIRE(source->size() == 0);
+        REQUIRE(source->all_succeeded());
+        REQUIRE(source->failure_bits() == nullptr);
+
+        ResultBatch<BatchErrorCodes> moved(std::move(*target));
+
+        REQUIRE(moved.size() == 100);
+        REQUIRE(moved.failed(42));
+        REQUIRE(target->size() == 0);
+        REQUIRE(target->count_failed() == 0);
+    }
+
+    {
+        //  Round trip through individual Results.
+
+        std::vector<Result<BatchErrorCodes>> results;
+
+        for (int i = 0; i < 100; i++)
+        {
+            results.push_back(i % 7 == 0 ? Result<BatchErrorCodes>::failure(BatchErrorCodes::FAILURE_2, "failure {}", i)
+                                         : Result<BatchErrorCodes>::success());
+        }
+
+        auto batch = ResultBatch<BatchErrorCodes>::from_results(results);
+
+        REQUIRE(batch.count_failed() == 15);
+
+        auto round_trip = batch.to_results();
+
+        REQUIRE(round_trip.size() == results.size());
+
+        for (std::size_t i = 0; i < results.size(); i++)
+        {
+            REQUIRE(round_trip[i].succeeded() == results[i].succeeded());
+            REQUIRE(round_trip[i].error_code() == results[i].error_code());
+            REQUIRE(round_trip[i].message() == results[i].message());
+        }
+    }
+}
+
+TEST_CASE("Result Set Test", "[batch-checks]")
+{
+    typedef ResultWithReturnValue<BatchErrorCodes, std::string> StringResult;
+
+    std::vector<StringResult> results;
+
+    results.push_back(StringResult::success("zero"));
+    results.push_back(StringResult::failure(BatchErrorCodes::FAILURE_1, "no value"));
+    results.push_back(StringResult::success("two"));
+
+    auto result_set = ResultSet<BatchErrorCodes, std::string>::from_results(std::move(results));
+
+    REQUIRE(result_set.size() == 3);
+    REQUIRE(result_set.count_failed() == 1);
+    REQUIRE(result_set.return_value(0) == "zero");
+    REQUIRE(result_set.return_value(2) == "two");
+    REQUIRE(result_set.failed(1));
+
+    auto testResult1 = result_set.result(1);
+
+    REQUIRE(testResult1.failed());
+    REQUIRE(testResult1.error_code() == BatchErrorCodes::FAILURE_1);
+    REQUIRE(testResult1.message() == "no value");
+    REQUIRE(result_set.result(2).return_value() == "two");
+
+    result_set.set(1, StringResult::success("one"));
+
+    REQUIRE(result_set.all_succeeded());
+    REQUIRE(result_set.return_value(1) == "one");
+
+    //  An entry marked successful without a value does not keep the value it held before.
+
+    result_set.set_success(2);
+
+    REQUIRE(result_set.return_value(2).empty());
+
+    result_set.set(2, StringResult::failure(BatchErrorCodes::FAILURE_2, "no value"));
+    result_set.set_success(2, "two again");
+
+    REQUIRE(result_set.all_succeeded());
+    REQUIRE(result_set.return_value(2) == "two again");
+
+    {
+        //  Values are moved out of a range passed as an rvalue and copied out of one passed as an lvalue.
+
+        typedef ResultWithReturnValue<BatchErrorCodes, CopyCountedValue> CountedResult;
+
+        std::vector<CountedResult> counted_results;
+
+        for (int i = 0; i < 8; i++)
+        {
+            counted_results.push_back(i % 3 == 2 ? CountedResult::failure(BatchErrorCodes::FAILURE_1, "no value")
+                                                 : CountedResult::success(CopyCountedValue(i)));
+        }
+
+        CopyCountedValue::copies = 0;
+
+        auto copied_set = ResultSet<BatchErrorCodes, CopyCountedValue>::from_results(counted_results);
+
+        REQUIRE(CopyCountedValue::copies > 0);
+        REQUIRE(copied_set.return_value(7).value_ == 7);
+        REQUIRE(counted_results[7].return_value().value_ == 7);
+
+        CopyCountedValue::copies = 0;
+
+        auto moved_set = ResultSet<BatchErrorCodes, CopyCountedValue>::from_results(std::move(counted_results));
+
+        REQUIRE(CopyCountedValue::copies == 0);
+        REQUIRE(moved_set.count_failed() == 2);
+        REQUIRE(moved_set.return_value(0).value_ == 0);
+        REQUIRE(moved_set.return_value(7).value_ == 7);
+    }
+
+    {
+        //  Copies allocate their return values, like their outcomes, from the current result memory resource.
+
+        alignas(std::max_align_t) std::byte buffer[4096];
+        std::pmr::monotonic_buffer_resource copy_resource(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+
+        std::optional<ResultSet<BatchErrorCodes, std::string>> set_copy;
+
+        {
+            ScopedResultMemoryResource scoped_resource(&copy_resource);
+
+            set_copy.emplace(result_set);
+        }
+
+        const std::byte* return_value = reinterpret_cast<const std::byte*>(&set_copy->return_value(2));
+
+        REQUIRE(return_value >= buffer);
+        REQUIRE(return_value < buffer + sizeof(buffer));
+        REQUIRE(set_copy->return_value(2) == "two again");
+
+        //  Moving a set leaves the source empty.
+
+        ResultSet<BatchErrorCodes, std::string> moved_set(std::move(*set_copy));
+
+        REQUIRE(moved_set.size() == 3);
+        REQUIRE(moved_set.return_value(0) == "zero");
+        REQUIRE(set_copy->size() == 0);
+
+        *set_copy = std::move(moved_set);
+
+        REQUIRE(set_copy->size() == 3);
+        REQUIRE(set_copy->return_value(1) == "one");
+        REQUIRE(moved_set.size() == 0);
+    }
+}
@@ -1,6 +1,11 @@
 #include <catch2/catch_all.hpp>
 
+#include <memory_resource>
+#include <vector>
+
+#include "AllocationCounter.hpp"
 #include "CPPResult.hpp"
+#include "CopyCounter.hpp"
 
 //  The pragma below is to disable to false errors flagged by intellisense for
 //  Catch2 REQUIRE macros.
@@ -15,6 +20,14 @@ using SEFUtility::ResultWithReturnRef;
 using SEFUtility::ResultWithReturnSharedPtr;
 using SEFUtility::ResultWithReturnUniquePtr;
 using SEFUtility::ResultWithReturnValue;
+using SEFUtility::ScopedResultMemoryResource;
+using SEFUtility::StaticMessage;
+using SEFUtility::ThreadLocalFreeListResource;
+using SEFUtilityTest::AllocationCounter;
+using SEFUtilityTest::CopyCounter;
+using SEFUtilityTest::CountedPayload;
+
+using namespace SEFUtility::literals;
 
 enum class ErrorCodes1
 {
@@ -484,3 +497,1145 @@ TEST_CASE("Result with Return Shared Ptr Test", "[basic-checks]")
     REQUIRE(testResult1.inner_error()->error_code_value() == 1000);
     REQUIRE(!testResult1.inner_error()->inner_error());
 }
+
+static_assert(std::is_nothrow_move_constructible_v<Result<ErrorCodes1>>);
+static_assert(std::is_nothrow_move_assignable_v<Result<ErrorCodes1>>);
+static_assert(std::is_nothrow_move_constructible_v<ResultWithReturnValue<ErrorCodes1, std::string>>);
+static_assert(std::is_nothrow_move_assignable_v<ResultWithReturnValue<ErrorCodes1, std::string>>);
+static_assert(std::is_nothrow_move_constructible_v<ResultWithReturnRef<ErrorCodes1, std::string>>);
+static_assert(std::is_nothrow_move_constructible_v<ResultWithReturnUniquePtr<ErrorCodes1, std::string>>);
+static_assert(std::is_nothrow_move_assignable_v<ResultWithReturnUniquePtr<ErrorCodes1, std::string>>);
+static_assert(std::is_nothrow_move_constructible_v<ResultWithReturnSharedPtr<ErrorCodes1, std::string>>);
+static_assert(std::is_nothrow_move_assignable_v<ResultWithReturnSharedPtr<ErrorCodes1, std::string>>);
+
+TEST_CASE("Result Move Test", "[move-checks]")
+{
+    //  Messages are long enough to defeat the small string optimization so a copy would allocate.
+
+    auto innerResult = Result<ErrorCodes2>::failure(ErrorCodes2::FAILURE_1, "inner message long enough to allocate");
+    auto testResult1 =
+        Result<ErrorCodes1>::failure(innerResult, ErrorCodes1::FAILURE_2, "outer message long enough to allocate");
+
+    {
+        AllocationCounter counter;
+
+        Result<ErrorCodes1> movedResult(std::move(testResult1));
+
+        REQUIRE(counter.allocations() == 0);
+        REQUIRE(movedResult.failed());
+        REQUIRE(movedResult.error_code() == ErrorCodes1::FAILURE_2);
+        REQUIRE(movedResult.message() == "outer message long enough to allocate");
+        REQUIRE(movedResult.inner_error());
+        REQUIRE(movedResult.inner_error()->message() == "inner message long enough to allocate");
+        REQUIRE(!testResult1.inner_error());
+
+        auto testResult2 = Result<ErrorCodes1>::success();
+
+        AllocationCounter assignment_counter;
+
+        testResult2 = std::move(movedResult);
+
+        REQUIRE(assignment_counter.allocations() == 0);
+        REQUIRE(testResult2.failed());
+        REQUIRE(testResult2.error_code() == ErrorCodes1::FAILURE_2);
+        REQUIRE(testResult2.message() == "outer message long enough to allocate");
+        REQUIRE(testResult2.inner_error());
+        REQUIRE(testResult2.inner_error()->error_code_value() == 1000);
+    }
+
+    {
+        auto testResult3 = ResultWithReturnValue<ErrorCodes1, std::string>::success(
+            std::string("return value long enough to allocate"));
+
+        AllocationCounter counter;
+
+        auto movedResult(std::move(testResult3));
+
+        REQUIRE(counter.allocations() == 0);
+        REQUIRE(movedResult.succeeded());
+        REQUIRE(movedResult.return_value() == "return value long enough to allocate");
+
+        auto testResult4 = ResultWithReturnValue<ErrorCodes1, std::string>::failure(
+            innerResult, ErrorCodes1::FAILURE_3, "failure message long enough to allocate");
+
+        AllocationCounter assignment_counter;
+
+        movedResult = std::move(testResult4);
+
+        REQUIRE(assignment_counter.allocations() == 0);
+        REQUIRE(movedResult.failed());
+        REQUIRE(movedResult.message() == "failure message long enough to allocate");
+        REQUIRE(movedResult.inner_error());
+    }
+
+    {
+        std::string return_value("returned value");
+
+        auto testResult5 = ResultWithReturnRef<ErrorCodes1, std::string>(return_value);
+
+        AllocationCounter counter;
+
+        auto movedResult(std::move(testResult5));
+
+        REQUIRE(counter.allocations() == 0);
+        REQUIRE(&movedResult.return_ref() == &return_value);
+    }
+
+    {
+        auto testResult6 = ResultWithReturnUniquePtr<ErrorCodes1, std::string>::success(
+            std::make_unique<std::string>("returned value"));
+
+        AllocationCounter counter;
+
+        ResultWithReturnUniquePtr<ErrorCodes1, std::string> movedResult(std::move(testResult6));
+
+        REQUIRE(counter.allocations() == 0);
+        REQUIRE(*movedResult.return_ptr() == "returned value");
+        REQUIRE(!testResult6.return_ptr());
+
+        auto testResult7 = ResultWithReturnUniquePtr<ErrorCodes1, std::string>::failure(
+            innerResult, ErrorCodes1::FAILURE_1, "failure message long enough to allocate");
+
+        AllocationCounter assignment_counter;
+
+        movedResult = std::move(testResult7);
+
+        REQUIRE(assignment_counter.allocations() == 0);
+        REQUIRE(movedResult.failed());
+        REQUIRE(!movedResult.return_ptr());
+        REQUIRE(movedResult.inner_error());
+    }
+
+    {
+        auto return_value = std::make_shared<std::string>("returned value");
+
+        auto testResult8 = ResultWithReturnSharedPtr<ErrorCodes1, std::string>(return_value);
+
+        AllocationCounter counter;
+
+        auto movedResult(std::move(testResult8));
+
+        REQUIRE(counter.allocations() == 0);
+        REQUIRE(movedResult.return_ptr() == return_value);
+        REQUIRE(return_value.use_count() == 2);
+    }
+
+    {
+        //  Vector growth relocates elements with move_if_noexcept, so only the buffer itself is allocated.
+
+        std::vector<Result<ErrorCodes1>> results;
+
+        results.reserve(1);
+        results.push_back(Result<ErrorCodes1>::failure(innerResult, ErrorCodes1::FAILURE_1,
+                                                       "failure message long enough to allocate"));
+
+        AllocationCounter counter;
+
+        results.reserve(16);
+
+        REQUIRE(counter.allocations() == 1);
+        REQUIRE(results[0].inner_error());
+        REQUIRE(results[0].message() == "failure message long enough to allocate");
+    }
+}
+
+//  Memory resource which counts the blocks it hands out from a fixed buffer, so it never touches the global heap.
+
+class CountingMemoryResource : public std::pmr::memory_resource
+{
+   public:
+    size_t allocations() const { return (allocations_); }
+
+    size_t outstanding() const { return (outstanding_); }
+
+   private:
+    void* do_allocate(size_t bytes, size_t alignment) override
+    {
+        allocations_++;
+        outstanding_++;
+
+        return (upstream_.allocate(bytes, alignment));
+    }
+
+    void do_deallocate(void* block, size_t bytes, size_t alignment) override
+    {
+        outstanding_--;
+
+        upstream_.deallocate(block, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return (this == &other); }
+
+    alignas(std::max_align_t) std::byte buffer_[4096];
+    std::pmr::monotonic_buffer_resource upstream_{buffer_, sizeof(buffer_), std::pmr::null_memory_resource()};
+
+    size_t allocations_ = 0;
+    size_t outstanding_ = 0;
+};
+
+//  A Result holds a lazy failure's captured arguments through a single pointer, so the Result stays the same
+//      size whether or not its failure is lazy.  Lazy format strings are checked when the failure is built.
+
+static_assert(sizeof(SEFUtility::DeferredMessage) == sizeof(void*));
+static_assert(sizeof(Result<ErrorCodes1>) <= 16 * sizeof(void*));
+static_assert(sizeof(ResultWithReturnValue<ErrorCodes1, int>) <= 17 * sizeof(void*));
+
+static_assert(SEFUtility::format_string_matches("{} and {:>{}}", 3));
+static_assert(SEFUtility::format_string_matches("{1} {0} {{literal}}", 2));
+static_assert(!SEFUtility::format_string_matches("{} {}", 1));
+static_assert(!SEFUtility::format_string_matches("{0} {}", 2));
+static_assert(!SEFUtility::format_string_matches("{name}", 1));
+static_assert(!SEFUtility::format_string_matches("unbalanced {", 1));
+static_assert(!SEFUtility::format_string_matches("unbalanced }", 0));
+
+TEST_CASE("Result Lazy Failure Test", "[lazy-checks]")
+{
+    {
+        //  A lazy failure which is never read allocates only the block holding its arguments, from the result
+        //      memory resource, and copies of it share that block.
+
+        CountingMemoryResource resource;
+        ScopedResultMemoryResource scoped_resource(&resource);
+        AllocationCounter counter;
+
+        auto testResult1 =
+            Result<ErrorCodes1>::lazy_failure(ErrorCodes1::FAILURE_1, "lazily formatted message {} {}", "test 1", 42);
+
+        REQUIRE(resource.allocations() == 1);
+        REQUIRE(testResult1.failed());
+        REQUIRE(testResult1.error_code() == ErrorCodes1::FAILURE_1);
+
+        auto testResult1Copy(testResult1);
+
+        REQUIRE(resource.allocations() == 1);
+        REQUIRE(counter.allocations() == 0);
+
+        REQUIRE(testResult1.message() == "lazily formatted message test 1 42");
+        REQUIRE(testResult1.message() == "lazily formatted message test 1 42");
+        REQUIRE(resource.outstanding() == 2);
+        REQUIRE(testResult1Copy.message() == "lazily formatted message test 1 42");
+        REQUIRE(resource.outstanding() == 2);
+    }
+
+    auto testResult2 = Result<ErrorCodes1>::failure(ErrorCodes1::FAILURE_2, "message {} {}", "test 2", 35);
+    auto testResult3 = Result<ErrorCodes2>::lazy_failure(testResult2, ErrorCodes2::FAILURE_3, "message {} {}",
+                                                         std::string_view("test 3"), 2.5);
+
+    REQUIRE(testResult3.failed());
+    REQUIRE(testResult3.error_code() == ErrorCodes2::FAILURE_3);
+    REQUIRE(testResult3.message() == "message test 3 2.5");
+    REQUIRE(testResult3.inner_error());
+    REQUIRE(testResult3.inner_error()->message() == "message test 2 35");
+
+    auto testResult4 = ResultWithReturnValue<ErrorCodes1, std::string>::lazy_failure(
+        testResult3, ErrorCodes1::FAILURE_1, "message {}", 4);
+
+    REQUIRE(testResult4.failed());
+    REQUIRE(testResult4.message() == "message 4");
+    REQUIRE(testResult4.inner_error()->message() == "message test 3 2.5");
+
+    auto testResult5 =
+        ResultWithReturnRef<ErrorCodes1, std::string>::lazy_failure(ErrorCodes1::FAILURE_2, "message {}", 5);
+    auto testResult6 =
+        ResultWithReturnUniquePtr<ErrorCodes1, std::string>::lazy_failure(ErrorCodes1::FAILURE_3, "message {}", 6);
+    auto testResult7 =
+        ResultWithReturnSharedPtr<ErrorCodes1, std::string>::lazy_failure(ErrorCodes1::FAILURE_1, "message {}", 7);
+
+    auto testResult8 = Result<ErrorCodes1>::success();
+
+    testResult8 = testResult7;
+
+    REQUIRE(testResult5.message() == "message 5");
+    REQUIRE(testResult6.message() == "message 6");
+    REQUIRE(testResult7.message() == "message 7");
+    REQUIRE(testResult8.failed());
+    REQUIRE(testResult8.message() == "message 7");
+}
+
+TEST_CASE("Result Shared Inner Error Chain Test", "[chain-checks]")
+{
+    auto testResult1 = Result<ErrorCodes1>::failure(ErrorCodes1::FAILURE_1, "depth {}", 0);
+
+    for (int depth = 1; depth < 32; depth++)
+    {
+        testResult1 = Result<ErrorCodes1>::failure(testResult1, ErrorCodes1::FAILURE_2, "depth {}", depth);
+    }
+
+    {
+        //  Copying shares the chain, so only the top level message could allocate and it is short.
+
+        AllocationCounter counter;
+
+        auto testResult1Copy(testResult1);
+        auto testResult2 = Result<ErrorCodes1>::success();
+
+        testResult2 = testResult1;
+
+        REQUIRE(counter.allocations() == 0);
+        REQUIRE(testResult1Copy.inner_error().get() == testResult1.inner_error().get());
+        REQUIRE(testResult2.inner_error().get() == testResult1.inner_error().get());
+        REQUIRE(testResult1Copy.message() == "depth 31");
+    }
+
+    {
+        //  Wrapping a result allocates a single node whatever the depth of its chain.  The node comes from
+        //      the global heap so a block cached by the default resource cannot hide the allocation.
+
+        ScopedResultMemoryResource heap_resource(std::pmr::new_delete_resource());
+        AllocationCounter counter;
+
+        auto testResult3 = Result<ErrorCodes2>::failure(testResult1, ErrorCodes2::FAILURE_3, "wrapper");
+
+        REQUIRE(counter.allocations() == 1);
+        REQUIRE(testResult3.inner_error()->message() == "depth 31");
+        REQUIRE(testResult3.inner_error()->inner_error().get() == testResult1.inner_error().get());
+
+        //  Nodes already in a chain are shared rather than copied when used as an inner error.
+
+        AllocationCounter rewrap_counter;
+
+        auto testResult4 = Result<ErrorCodes2>::failure(*testResult1.inner_error(), ErrorCodes2::FAILURE_1, "rewrap");
+
+        REQUIRE(rewrap_counter.allocations() == 0);
+        REQUIRE(testResult4.inner_error().get() == testResult1.inner_error().get());
+    }
+
+    int depth = 31;
+
+    for (const ResultBase* node = &testResult1; node != nullptr; node = node->inner_error().get())
+    {
+        REQUIRE(node->message() == fmt::format("depth {}", depth--));
+    }
+
+    REQUIRE(depth == -1);
+
+    //  The chain outlives the result it was created from.
+
+    auto testResult5 = Result<ErrorCodes2>::success();
+
+    {
+        auto innerResult = Result<ErrorCodes1>::lazy_failure(ErrorCodes1::FAILURE_3, "lazy inner {}", 5);
+
+        testResult5 = Result<ErrorCodes2>::failure(innerResult, ErrorCodes2::FAILURE_2, "outer");
+    }
+
+    REQUIRE(testResult5.inner_error());
+    REQUIRE(testResult5.inner_error()->message() == "lazy inner 5");
+    REQUIRE(testResult5.inner_error() != nullptr);
+}
+
+TEST_CASE("Result Memory Resource Test", "[memory-checks]")
+{
+    const char* long_message = "a message long enough to defeat the small string optimization of the standard library";
+
+    {
+        //  Messages and inner error nodes come from the resource current when they are created.
+
+        CountingMemoryResource resource;
+
+        {
+            ScopedResultMemoryResource scoped_resource(&resource);
+            AllocationCounter counter;
+
+            auto testResult1 = Result<ErrorCodes1>::failure(ErrorCodes1::FAILURE_1, long_message);
+            auto testResult2 = Result<ErrorCodes2>::failure(testResult1, ErrorCodes2::FAILURE_2, "{}", long_message);
+
+            REQUIRE(counter.allocations() == 0);
+            REQUIRE(resource.allocations() == 4);
+            REQUIRE(testResult2.message() == long_message);
+            REQUIRE(testResult2.inner_error()->message() == long_message);
+        }
+
+        REQUIRE(resource.outstanding() == 0);
+
+        //  Results release memory to the resource they allocated from even after it is no longer current.
+
+        std::pmr::memory_resource* previous_resource = SEFUtility::set_result_memory_resource(&resource);
+
+        {
+            auto testResult3 = Result<ErrorCodes1>::failure(ErrorCodes1::FAILURE_3, long_message);
+
+            SEFUtility::set_result_memory_resource(previous_resource);
+
+            REQUIRE(SEFUtility::result_memory_resource() == previous_resource);
+            REQUIRE(resource.outstanding() == 1);
+        }
+
+        REQUIRE(resource.outstanding() == 0);
+    }
+
+    {
+        //  Move assignment between results allocated from different resources neither copies nor allocates,
+        //      the message stays with the resource it came from.
+
+        CountingMemoryResource source_resource;
+        CountingMemoryResource target_resource;
+
+        std::pmr::memory_resource* previous_resource = SEFUtility::set_result_memory_resource(&target_resource);
+
+        {
+            auto target = Result<ErrorCodes1>::failure(ErrorCodes1::FAILURE_1, long_message);
+
+            SEFUtility::set_result_memory_resource(&source_resource);
+
+            auto source = Result<ErrorCodes1>::failure(ErrorCodes1::FAILURE_2, long_message);
+
+            SEFUtility::set_result_memory_resource(previous_resource);
+
+            AllocationCounter counter;
+
+            target = std::move(source);
+
+            REQUIRE(counter.allocations() == 0);
+            REQUIRE(source_resource.allocations() == 1);
+            REQUIRE(target_resource.allocations() == 1);
+            REQUIRE(target_resource.outstanding() == 0);
+            REQUIRE(target.error_code() == ErrorCodes1::FAILURE_2);
+            REQUIRE(target.message() == long_message);
+
+            //  Between results sharing a resource the messages are exchanged.
+
+            SEFUtility::set_result_memory_resource(&source_resource);
+
+            auto other = Result<ErrorCodes1>::failure(ErrorCodes1::FAILURE_3, long_message);
+
+            SEFUtility::set_result_memory_resource(previous_resource);
+
+            other = std::move(target);
+
+            REQUIRE(counter.allocations() == 0);
+            REQUIRE(source_resource.allocations() == 2);
+            REQUIRE(source_resource.outstanding() == 2);
+            REQUIRE(other.error_code() == ErrorCodes1::FAILURE_2);
+            REQUIRE(other.message() == long_message);
+        }
+
+        REQUIRE(source_resource.outstanding() == 0);
+        REQUIRE(target_resource.outstanding() == 0);
+    }
+
+    {
+        //  Once warmed up, the default resource serves bursts of failures without touching the global heap.
+
+        auto burst = [long_message]()
+        {
+            std::vector<Result<ErrorCodes2>> failures;
+
+            failures.reserve(64);
+
+            for (int i = 0; i < 64; i++)
+            {
+                auto inner = Result<ErrorCodes1>::failure(ErrorCodes1::FAILURE_1, long_message);
+
+                failures.emplace_back(Result<ErrorCodes2>::failure(inner, ErrorCodes2::FAILURE_1, "{} {}", long_message, i));
+            }
+
+            return (failures.size());
+        };
+
+        REQUIRE(burst() == 64);
+        REQUIRE(ThreadLocalFreeListResource::cached_blocks() > 0);
+
+        AllocationCounter counter;
+
+        REQUIRE(burst() == 64);
+        REQUIRE(counter.allocations() == 1);
+    }
+}
+
+TEST_CASE("Result Static Message Test", "[static-message-checks]")
+{
+    static constexpr std::string_view long_message =
+        "a message long enough to defeat the small string optimization of the standard library";
+
+    CountingMemoryResource resource;
+    ScopedResultMemoryResource scoped_resource(&resource);
+
+    {
+        //  Successes and literal failures reference their text rather than copying it.
+
+        AllocationCounter counter;
+
+        auto testResult1 = Result<ErrorCodes1>::success();
+        auto testResult2 = Result<ErrorCodes1>::failure(ErrorCodes1::FAILURE_1, StaticMessage(long_message));
+        auto testResult3 = Result<ErrorCodes1>::failure(ErrorCodes1::FAILURE_2, "literal message"_msg);
+        auto testResult2Copy(testResult2);
+
+        testResult1 = testResult3;
+
+        REQUIRE(counter.allocations() == 0);
+        REQUIRE(resource.allocations() == 0);
+        REQUIRE(testResult2.message().data() == long_message.data());
+        REQUIRE(testResult2Copy.message().data() == long_message.data());
+        REQUIRE(testResult1.message() == "literal message");
+        REQUIRE(testResult1.error_code() == ErrorCodes1::FAILURE_2);
+        REQUIRE(Result<ErrorCodes2>::success().message() == "Success");
+
+        //  Wrapping allocates the chain node but not its message.
+
+        auto testResult4 = Result<ErrorCodes2>::failure(testResult2, ErrorCodes2::FAILURE_1, "wrapper"_msg);
+
+        REQUIRE(resource.allocations() == 1);
+        REQUIRE(testResult4.message() == "wrapper");
+        REQUIRE(testResult4.inner_error()->message().data() == long_message.data());
+    }
+
+    {
+        //  A dynamic message assigned over a static one is copied, and vice versa.
+
+        auto testResult1 = Result<ErrorCodes1>::failure(ErrorCodes1::FAILURE_1, StaticMessage(long_message));
+
+        testResult1 = Result<ErrorCodes1>::failure(ErrorCodes1::FAILURE_2, "dynamic {}", 1);
+
+        REQUIRE(testResult1.message() == "dynamic 1");
+
+        testResult1 = Result<ErrorCodes1>::failure(ErrorCodes1::FAILURE_3, "static"_msg);
+
+        REQUIRE(testResult1.message() == "static");
+    }
+
+    {
+        //  Interned messages are stored once and shared by every Result using the same text.
+
+        std::string first_text = fmt::format("interned {}", long_message);
+        std::string second_text = fmt::format("interned {}", long_message);
+
+        StaticMessage first_message = StaticMessage::intern(first_text);
+        StaticMessage second_message = StaticMessage::intern(second_text);
+
+        REQUIRE(first_message.view() == first_text);
+        REQUIRE(first_message.view().data() == second_message.view().data());
+        REQUIRE(first_message.view().data() != first_text.data());
+
+        AllocationCounter counter;
+
+        REQUIRE(StaticMessage::intern(first_text).view().data() == first_message.view().data());
+
+        auto testResult1 = Result<ErrorCodes1>::failure(ErrorCodes1::FAILURE_1, StaticMessage::intern(second_text));
+
+        REQUIRE(counter.allocations() == 0);
+        REQUIRE(testResult1.message().data() == first_message.view().data());
+    }
+
+    {
+        //  Every Result class accepts static messages.
+
+        int value = 7;
+        auto testResult1 = ResultWithReturnValue<ErrorCodes1, int>::failure(ErrorCodes1::FAILURE_1, "value"_msg);
+        auto testResult2 = ResultWithReturnRef<ErrorCodes1, int>::failure(ErrorCodes1::FAILURE_2, "ref"_msg);
+        auto testResult3 =
+            ResultWithReturnUniquePtr<ErrorCodes1, int>::failure(testResult1, ErrorCodes1::FAILURE_3, "unique"_msg);
+        auto testResult4 =
+            ResultWithReturnSharedPtr<ErrorCodes1, int>::failure(testResult2, ErrorCodes1::FAILURE_1, "shared"_msg);
+        ResultWithReturnRef<ErrorCodes1, int> testResult5(value);
+
+        REQUIRE(testResult1.message() == "value");
+        REQUIRE(testResult2.message() == "ref");
+        REQUIRE(testResult3.message() == "unique");
+        REQUIRE(testResult3.inner_error()->message() == "value");
+        REQUIRE(testResult4.message() == "shared");
+        REQUIRE(testResult4.inner_error()->message() == "ref");
+        REQUIRE(testResult5.message() == "Success");
+    }
+}
+
+//  Value type which counts its copies, so the monadic tests can check payloads are moved through a pipeline.
+
+struct CopyCountingValue
+{
+    explicit CopyCountingValue(int value) : value_(value) {}
+
+    CopyCountingValue(const CopyCountingValue& value_to_copy) : value_(value_to_copy.value_) { copies_++; }
+
+    CopyCountingValue(CopyCountingValue&& value_to_move) noexcept : value_(value_to_move.value_) {}
+
+    CopyCountingValue& operator=(const CopyCountingValue& value_to_copy)
+    {
+        value_ = value_to_copy.value_;
+        copies_++;
+
+        return (*this);
+    }
+
+    CopyCountingValue& operator=(CopyCountingValue&& value_to_move) noexcept
+    {
+        value_ = value_to_move.value_;
+
+        return (*this);
+    }
+
+    int value_;
+
+    static inline int copies_ = 0;
+};
+
+TEST_CASE("Result Monadic Operations Test", "[monadic-checks]")
+{
+    typedef ResultWithReturnValue<ErrorCodes1, CopyCountingValue> ValueResult;
+
+    auto parse = [](int value) {
+        return (value < 0 ? ValueResult::failure(ErrorCodes1::FAILURE_1, "negative {}", value)
+                          : ValueResult::success(CopyCountingValue(value)));
+    };
+
+    auto double_it = [](CopyCountingValue&& value) {
+        value.value_ *= 2;
+        return (ValueResult::success(std::move(value)));
+    };
+
+    {
+        //  Successful pipelines move the payload through every step.
+
+        CopyCountingValue::copies_ = 0;
+
+        auto testResult1 = parse(5).and_then(double_it).transform([](CopyCountingValue&& value) {
+            return (value.value_ + 1);
+        });
+
+        static_assert(std::is_same_v<decltype(testResult1), ResultWithReturnValue<ErrorCodes1, int>>);
+
+        REQUIRE(CopyCountingValue::copies_ == 0);
+        REQUIRE(testResult1.succeeded());
+        REQUIRE(testResult1.return_value() == 11);
+        REQUIRE(std::move(testResult1).value_or(0) == 11);
+
+        //  Continuations on lvalues see the payload by reference.
+
+        auto testResult2 = parse(3);
+        auto testResult3 = testResult2.transform([](CopyCountingValue& value) { return (value.value_); });
+
+        REQUIRE(testResult3.return_value() == 3);
+        REQUIRE(testResult2.return_value().value_ == 3);
+        REQUIRE(CopyCountingValue::copies_ == 0);
+
+        //  Transforms returning void yield a plain Result.
+
+        int seen = 0;
+        auto testResult4 = parse(7).transform([&seen](CopyCountingValue&& value) { seen = value.value_; });
+
+        static_assert(std::is_same_v<decltype(testResult4), Result<ErrorCodes1>>);
+
+        REQUIRE(testResult4.succeeded());
+        REQUIRE(seen == 7);
+    }
+
+    {
+        //  Failures skip the remaining steps and carry their message and inner error chain unchanged.
+
+        auto testResult1 = Result<ErrorCodes2>::failure(ErrorCodes2::FAILURE_1, "root cause");
+        auto testResult2 = ValueResult::failure(testResult1, ErrorCodes1::FAILURE_2, "wrapped");
+        const ResultBase* inner_error = testResult2.inner_error().get();
+
+        int steps = 0;
+
+        auto testResult3 = std::move(testResult2)
+                               .and_then([&steps](CopyCountingValue&& value) {
+                                   steps++;
+                                   return (ValueResult::success(std::move(value)));
+                               })
+                               .transform([&steps](CopyCountingValue&& value) {
+                                   steps++;
+                                   return (value.value_);
+                               });
+
+        REQUIRE(steps == 0);
+        REQUIRE(testResult3.failed());
+        REQUIRE(testResult3.error_code() == ErrorCodes1::FAILURE_2);
+        REQUIRE(testResult3.message() == "wrapped");
+        REQUIRE(testResult3.inner_error().get() == inner_error);
+        REQUIRE(testResult3.value_or(-1) == -1);
+
+        //  and_then may change the Result class as long as the error code type is unchanged.
+
+        auto testResult4 = parse(-2).and_then([](CopyCountingValue&& value) {
+            return (ResultWithReturnUniquePtr<ErrorCodes1, int>::success(std::make_unique<int>(value.value_)));
+        });
+
+        REQUIRE(testResult4.failed());
+        REQUIRE(testResult4.message() == "negative -2");
+
+        auto testResult5 = parse(-3).and_then([](CopyCountingValue&&) { return (Result<ErrorCodes1>::success()); });
+
+        REQUIRE(testResult5.failed());
+        REQUIRE(testResult5.error_code() == ErrorCodes1::FAILURE_1);
+    }
+
+    {
+        //  or_else only runs for failures and may recover or replace the error.
+
+        auto testResult1 = parse(-1).or_else([](const Result<ErrorCodes1>& error) {
+            REQUIRE(error.message() == "negative -1");
+            return (ValueResult::success(CopyCountingValue(0)));
+        });
+
+        REQUIRE(testResult1.succeeded());
+        REQUIRE(testResult1.return_value().value_ == 0);
+
+        auto testResult2 = parse(4).or_else([](const Result<ErrorCodes1>&) {
+            return (ResultWithReturnValue<ErrorCodes2, CopyCountingValue>::failure(ErrorCodes2::FAILURE_3, "unused"));
+        });
+
+        static_assert(std::is_same_v<decltype(testResult2), ResultWithReturnValue<ErrorCodes2, CopyCountingValue>>);
+
+        REQUIRE(testResult2.succeeded());
+        REQUIRE(testResult2.return_value().value_ == 4);
+
+        auto testResult3 = parse(-5).or_else([](Result<ErrorCodes1>&& error) {
+            return (ResultWithReturnValue<ErrorCodes2, CopyCountingValue>::failure(error, ErrorCodes2::FAILURE_3,
+                                                                                   "translated"));
+        });
+
+        REQUIRE(testResult3.error_code() == ErrorCodes2::FAILURE_3);
+        REQUIRE(testResult3.inner_error()->message() == "negative -5");
+    }
+
+    {
+        //  Pointer Results pass the pointer itself to their continuations.
+
+        auto testResult1 = ResultWithReturnUniquePtr<ErrorCodes1, int>::success(std::make_unique<int>(6))
+                               .and_then([](std::unique_ptr<int>&& value) {
+                                   *value += 1;
+                                   return (ResultWithReturnUniquePtr<ErrorCodes1, int>::success(std::move(value)));
+                               })
+                               .transform([](std::unique_ptr<int>&& value) { return (*value * 2); });
+
+        REQUIRE(testResult1.return_value() == 14);
+
+        auto testResult2 = ResultWithReturnUniquePtr<ErrorCodes1, int>::failure(ErrorCodes1::FAILURE_3, "no pointer");
+
+        REQUIRE(*std::move(testResult2).value_or(std::make_unique<int>(9)) == 9);
+
+        auto shared_value = std::make_shared<int>(8);
+        ResultWithReturnSharedPtr<ErrorCodes1, int> testResult3(shared_value);
+
+        auto testResult4 = testResult3.transform([](std::shared_ptr<int>& value) { return (*value + 1); });
+
+        REQUIRE(testResult4.return_value() == 9);
+        REQUIRE(testResult3.value_or(nullptr) == shared_value);
+
+        auto testResult5 = ResultWithReturnSharedPtr<ErrorCodes1, int>::failure(ErrorCodes1::FAILURE_2, "no pointer")
+                               .or_else([](const Result<ErrorCodes1>&) {
+                                   return (ResultWithReturnSharedPtr<ErrorCodes1, int>(std::make_shared<int>(1)));
+                               });
+
+        REQUIRE(*testResult5.return_ptr() == 1);
+    }
+}
+
+//  Enums of the same name in anonymous namespaces of different translation units share an error domain, the
+//      other one is defined in ErrorCodeTraitsTest.cpp.
+
+namespace
+{
+    enum class SameNamedErrors
+    {
+        SUCCESS = 0,
+        FAILURE_1 = 1000
+    };
+}  // namespace
+
+SEFUtility::InnerErrorPtr same_named_domain_failure();
+
+TEST_CASE("Result Error Domain Test", "[domain-checks]")
+{
+    {
+        //  Each error code enum has its own domain, shared by every Result type using it.
+
+        auto testResult1 = Result<ErrorCodes1>::failure(ErrorCodes1::FAILURE_1, "first");
+        auto testResult2 = ResultWithReturnValue<ErrorCodes1, int>::success(3);
+        auto testResult3 = Result<ErrorCodes2>::failure(ErrorCodes2::FAILURE_1, "second");
+
+        REQUIRE(testResult1.error_domain() == testResult2.error_domain());
+        REQUIRE(testResult1.error_domain() != testResult3.error_domain());
+        REQUIRE(testResult1.error_domain() == SEFUtility::ErrorCodeMetadata<ErrorCodes1>::domain_id());
+        REQUIRE(testResult3.error_code_value() == 1000);
+    }
+
+    {
+        auto inner = Result<ErrorCodes1>::failure(ErrorCodes1::FAILURE_2, "root cause");
+        auto middle = Result<ErrorCodes2>::failure(inner, ErrorCodes2::FAILURE_3, "middle");
+        auto outer = ResultWithReturnValue<ErrorCodes2, int>::failure(middle, ErrorCodes2::FAILURE_1, "outer");
+
+        AllocationCounter counter;
+
+        //  The search starts with the result itself.
+
+        REQUIRE(outer.find_in_chain<ErrorCodes2>() == &outer);
+        REQUIRE(outer.find_in_chain<ErrorCodes1>() == outer.inner_error()->inner_error().get());
+        REQUIRE(outer.find_in_chain<ErrorCodes1>()->error_code() == ErrorCodes1::FAILURE_2);
+        REQUIRE(outer.find_in_chain<SEFUtility::BaseResultCodes>() == nullptr);
+
+        REQUIRE(outer.contains_code(ErrorCodes2::FAILURE_3));
+        REQUIRE(outer.contains_code(ErrorCodes1::FAILURE_2));
+        REQUIRE(!outer.contains_code(ErrorCodes1::FAILURE_3));
+        REQUIRE(!outer.contains_code(ErrorCodes2::FAILURE_2));
+
+        //  Error code values are only compared within a domain.
+
+        REQUIRE(!middle.contains_code(ErrorCodes2::FAILURE_2));
+        REQUIRE(middle.inner_error()->contains_code(ErrorCodes1::FAILURE_2));
+
+        REQUIRE(counter.allocations() == 0);
+    }
+
+    {
+        //  A node whose domain matches but whose enum is another type is never returned or cast.
+
+        SEFUtility::InnerErrorPtr other_enum = same_named_domain_failure();
+
+        auto inner = Result<SameNamedErrors>::failure(SameNamedErrors::FAILURE_1, "this translation unit");
+        auto middle = Result<ErrorCodes1>::failure(*other_enum, ErrorCodes1::FAILURE_1, "middle");
+        auto outer = Result<ErrorCodes2>::failure(middle, ErrorCodes2::FAILURE_1, "outer");
+
+        REQUIRE(other_enum->error_domain() == inner.error_domain());
+        REQUIRE(outer.find_in_chain<SameNamedErrors>() == nullptr);
+        REQUIRE(!outer.contains_code(SameNamedErrors::FAILURE_1));
+        REQUIRE(outer.count_in_tree(SameNamedErrors::FAILURE_1) == 0);
+
+        std::vector<SEFUtility::InnerErrorPtr> causes{other_enum, inner.as_inner_error()};
+
+        auto both = Result<ErrorCodes2>::failure(causes, ErrorCodes2::FAILURE_2, "both");
+
+        REQUIRE(both.find_in_chain<SameNamedErrors>()->message() == "this translation unit");
+        REQUIRE(both.contains_code(SameNamedErrors::FAILURE_1));
+        REQUIRE(both.count_in_tree(SameNamedErrors::FAILURE_1) == 1);
+    }
+}
+
+TEST_CASE("Result Conversion Test", "[conversion-checks]")
+{
+    const std::string long_message(100, 'x');
+
+    {
+        //  as_result() is the Result itself, inner error included.
+
+        auto inner = Result<ErrorCodes1>::failure(ErrorCodes1::FAILURE_1, "inner");
+        auto testResult1 =
+            ResultWithReturnValue<ErrorCodes1, int>::failure(inner, ErrorCodes1::FAILURE_2, long_message);
+        int value = 1;
+        auto testResult2 = ResultWithReturnRef<ErrorCodes1, int>(value);
+
+        AllocationCounter counter;
+
+        const Result<ErrorCodes1>& view1 = testResult1.as_result();
+        const Result<ErrorCodes1>& view2 = testResult2.as_result();
+
+        REQUIRE(static_cast<const void*>(&view1) == static_cast<const void*>(&testResult1));
+        REQUIRE(view1.error_code() == ErrorCodes1::FAILURE_2);
+        REQUIRE(view1.message() == long_message);
+        REQUIRE(view1.inner_error()->message() == "inner");
+        REQUIRE(view2.succeeded());
+        REQUIRE(counter.allocations() == 0);
+    }
+
+    {
+        //  to_result() copies from an lvalue and moves from an rvalue.
+
+        auto inner = Result<ErrorCodes1>::failure(ErrorCodes1::FAILURE_1, "inner");
+        auto testResult1 =
+            ResultWithReturnUniquePtr<ErrorCodes1, int>::failure(inner, ErrorCodes1::FAILURE_3, long_message);
+        const SEFUtility::ResultBase* inner_node = testResult1.inner_error().get();
+
+        auto testResult2 = testResult1.to_result();
+
+        REQUIRE(testResult2.message() == long_message);
+        REQUIRE(testResult2.inner_error().get() == inner_node);
+        REQUIRE(testResult1.message() == long_message);
+
+        AllocationCounter counter;
+
+        auto testResult3 = std::move(testResult1).to_result();
+
+        REQUIRE(counter.allocations() == 0);
+        REQUIRE(testResult3.error_code() == ErrorCodes1::FAILURE_3);
+        REQUIRE(testResult3.message() == long_message);
+        REQUIRE(testResult3.inner_error().get() == inner_node);
+
+        auto testResult4 = ResultWithReturnSharedPtr<ErrorCodes1, int>(std::make_shared<int>(2)).to_result();
+
+        REQUIRE(testResult4.succeeded());
+        REQUIRE(testResult4.message() == "Success");
+    }
+}
+
+TEST_CASE("Result Formatter Test", "[format-checks]")
+{
+    auto inner = Result<ErrorCodes1>::failure(ErrorCodes1::FAILURE_1, "inner {}", 1);
+    auto middle = Result<ErrorCodes2>::failure(inner, ErrorCodes2::FAILURE_2, "middle"_msg);
+    unsigned int line = __LINE__ + 1;
+    auto outer = ResultWithReturnValue<ErrorCodes1, int>::failure(middle, ErrorCodes1::FAILURE_3, "outer");
+
+    {
+        //  Codes without ErrorCodeTraits are rendered by value.
+
+        REQUIRE(fmt::format("{}", outer) == "1002: outer <- 1001: middle <- 1000: inner 1");
+        REQUIRE(fmt::format("{:c}", outer) == fmt::format("{}", outer));
+        REQUIRE(fmt::format("{}", Result<ErrorCodes1>::success()) == "SUCCESS");
+        REQUIRE(fmt::format("[{:1}]", outer) == "[1002: outer <- ... 2 more]");
+        REQUIRE(fmt::format("{:0}", outer) == "... 3 more");
+        REQUIRE(fmt::format("{}", *outer.inner_error()) == "1001: middle <- 1000: inner 1");
+
+        const ResultBase& base = outer;
+
+        REQUIRE(fmt::format("{:3}", base) == fmt::format("{}", outer));
+    }
+
+    {
+        std::string verbose = fmt::format("{:v2}", outer);
+
+        REQUIRE(verbose.starts_with("1002 (ErrorCodes1 1002) at "));
+        REQUIRE(verbose.find("ResultTest.cpp:" + std::to_string(line) + ": outer\n") != std::string::npos);
+        REQUIRE(verbose.find("\n  caused by 1001 (ErrorCodes2 1001) at ") != std::string::npos);
+        REQUIRE(verbose.ends_with(": middle\n  ... 1 more\n"));
+    }
+
+    {
+        //  Formatting into a caller's buffer allocates nothing beyond the buffer itself.
+
+        fmt::memory_buffer buffer;
+
+        AllocationCounter counter;
+
+        fmt::format_to(std::back_inserter(buffer), "{}", outer);
+        SEFUtility::format_result(std::back_inserter(buffer), outer, SEFUtility::ResultFormatOptions{false, 1});
+
+        REQUIRE(counter.allocations() == 0);
+        REQUIRE(std::string_view(buffer.data(), buffer.size()) ==
+                "1002: outer <- 1001: middle <- 1000: inner 11002: outer <- ... 2 more");
+
+        //  Any output iterator may be written to.
+
+        std::string text;
+        std::vector<char> characters;
+
+        SEFUtility::format_result(std::back_inserter(text), *outer.inner_error());
+        SEFUtility::format_result(std::back_inserter(characters), *outer.inner_error());
+
+        REQUIRE(text == "1001: middle <- 1000: inner 1");
+        REQUIRE(std::string(characters.begin(), characters.end()) == text);
+    }
+
+    REQUIRE_THROWS_AS(fmt::vformat("{:x}", fmt::make_format_args(outer)), fmt::format_error);
+}
+
+TEST_CASE("Result Multiple Causes Test", "[causes-checks]")
+{
+    std::vector<Result<ErrorCodes1>> tasks;
+
+    for (int i = 0; i < 6; i++)
+    {
+        tasks.push_back((i % 3 == 0) ? Result<ErrorCodes1>::success()
+                                     : Result<ErrorCodes1>::failure(ErrorCodes1::FAILURE_1, "task {} failed", i));
+    }
+
+    auto nested = Result<ErrorCodes2>::failure(tasks[1], ErrorCodes2::FAILURE_2, "nested"_msg);
+
+    tasks.push_back(Result<ErrorCodes1>::failure(nested, ErrorCodes1::FAILURE_2, "task 6 failed"));
+
+    {
+        //  Failures become the causes in order, successes are skipped, and the first cause is the inner error.
+
+        auto job = Result<ErrorCodes2>::failure(tasks, ErrorCodes2::FAILURE_1, "{} tasks failed", 5);
+
+        REQUIRE(job.failed());
+        REQUIRE(job.message() == "5 tasks failed");
+        REQUIRE(job.causes().size() == 5);
+        REQUIRE(job.inner_error().get() == job.causes()[0].get());
+        REQUIRE(job.causes()[0]->message() == "task 1 failed");
+        REQUIRE(job.causes()[3]->message() == "task 5 failed");
+        REQUIRE(job.causes()[4]->inner_error()->message() == "nested");
+
+        //  Results with a single inner error or none present it through the same span.
+
+        REQUIRE(nested.causes().size() == 1);
+        REQUIRE(nested.causes()[0].get() == nested.inner_error().get());
+        REQUIRE(tasks[1].causes().empty());
+        REQUIRE(Result<ErrorCodes1>::success().causes().empty());
+
+        //  Copies share the causes.
+
+        auto copy = job;
+        auto moved = std::move(copy);
+
+        REQUIRE(moved.causes().data() == job.causes().data());
+
+        ResultWithReturnValue<ErrorCodes2, int> with_value(
+            Result<ErrorCodes2>::failure(tasks, ErrorCodes2::FAILURE_1, "tasks failed"));
+
+        REQUIRE(with_value.causes().size() == 5);
+        REQUIRE(with_value.as_inner_error()->causes().size() == 5);
+
+        //  Nothing failed, so there are no causes.
+
+        std::vector<Result<ErrorCodes1>> successes(3, Result<ErrorCodes1>::success());
+
+        auto no_causes = Result<ErrorCodes2>::failure(successes, ErrorCodes2::FAILURE_1, "nothing failed");
+
+        REQUIRE(no_causes.causes().empty());
+        REQUIRE(!no_causes.inner_error());
+    }
+
+    {
+        //  Depth first traversal visits every node of the tree in preorder.
+
+        auto job = Result<ErrorCodes2>::failure(tasks, ErrorCodes2::FAILURE_1, "tasks failed");
+
+        std::vector<std::pair<std::string, std::size_t>> visited;
+
+        job.visit_depth_first([&visited](const ResultBase& node, std::size_t depth) {
+            visited.emplace_back(node.message(), depth);
+        });
+
+        REQUIRE(visited.size() == 8);
+        REQUIRE(visited[0] == std::make_pair(std::string("tasks failed"), std::size_t(0)));
+        REQUIRE(visited[1] == std::make_pair(std::string("task 1 failed"), std::size_t(1)));
+        REQUIRE(visited[5] == std::make_pair(std::string("task 6 failed"), std::size_t(1)));
+        REQUIRE(visited[6] == std::make_pair(std::string("nested"), std::size_t(2)));
+        REQUIRE(visited[7] == std::make_pair(std::string("task 1 failed"), std::size_t(3)));
+
+        //  Filtering by code considers the domain as well as the value.
+
+        REQUIRE(job.count_in_tree(ErrorCodes1::FAILURE_1) == 5);
+        REQUIRE(job.count_in_tree(ErrorCodes1::FAILURE_2) == 1);
+        REQUIRE(job.count_in_tree(ErrorCodes2::FAILURE_2) == 1);
+        REQUIRE(job.count_in_tree(ErrorCodes2::FAILURE_1) == 1);
+        REQUIRE(job.count_in_tree(ErrorCodes1::FAILURE_3) == 0);
+
+        std::vector<std::size_t> depths;
+
+        job.for_each_with_code(ErrorCodes2::FAILURE_2, [&depths](const Result<ErrorCodes2>& node, std::size_t depth) {
+            REQUIRE(node.error_code() == ErrorCodes2::FAILURE_2);
+            depths.push_back(depth);
+        });
+
+        REQUIRE(depths == std::vector<std::size_t>{2});
+
+        //  Searches look beyond the first cause, in the same order as the traversal.
+
+        REQUIRE(job.contains_code(ErrorCodes1::FAILURE_2));
+        REQUIRE(job.contains_code(ErrorCodes2::FAILURE_2));
+        REQUIRE(!job.contains_code(ErrorCodes1::FAILURE_3));
+        REQUIRE(job.find_in_chain<ErrorCodes1>() == job.causes()[0].get());
+
+        std::vector<SEFUtility::InnerErrorPtr> mixed_causes{tasks[1].as_inner_error(), nested.as_inner_error()};
+
+        auto mixed = Result<ErrorCodes1>::failure(mixed_causes, ErrorCodes1::FAILURE_3, "mixed failed");
+
+        REQUIRE(mixed.find_in_chain<ErrorCodes2>() == mixed.causes()[1].get());
+        REQUIRE(mixed.find_in_chain<ErrorCodes2>()->error_code() == ErrorCodes2::FAILURE_2);
+        REQUIRE(mixed.find_in_chain<SEFUtility::BaseResultCodes>() == nullptr);
+
+        //  The formatter follows the first cause and counts the others.
+
+        REQUIRE(fmt::format("{}", job) == "1000: tasks failed (+4 more causes) <- 1000: task 1 failed");
+    }
+
+    {
+        //  The causes are held in a single block from the result memory resource.
+
+        std::vector<SEFUtility::InnerErrorPtr> causes;
+
+        for (const auto& task : tasks)
+        {
+            causes.push_back(task.as_inner_error());
+        }
+
+        causes.push_back(SEFUtility::InnerErrorPtr());
+
+        CountingMemoryResource resource;
+
+        {
+            ScopedResultMemoryResource scoped_resource(&resource);
+            AllocationCounter counter;
+
+            auto job = Result<ErrorCodes2>::failure(causes, ErrorCodes2::FAILURE_1, "tasks failed");
+
+            REQUIRE(counter.allocations() == 0);
+            REQUIRE(resource.allocations() == 1);
+            REQUIRE(job.causes().size() == 5);
+            REQUIRE(job.causes()[2].get() == causes[4].get());
+        }
+
+        REQUIRE(resource.outstanding() == 0);
+    }
+}
+
+static ResultWithReturnValue<ErrorCodes1, CountedPayload> make_payload_in_place(int value)
+{
+    return (ResultWithReturnValue<ErrorCodes1, CountedPayload>::success(std::in_place, value, "in place"));
+}
+
+static ResultWithReturnValue<ErrorCodes1, CountedPayload> return_payload(int value)
+{
+    CountedPayload payload(value, "returned");
+
+    return (payload);
+}
+
+TEST_CASE("Result In Place Construction Test", "[in-place-checks]")
+{
+    {
+        //  Values constructed in place are neither copied nor moved, even when the Result is returned.
+
+        CopyCounter counter;
+
+        auto testResult1 = ResultWithReturnValue<ErrorCodes1, CountedPayload>::success(std::in_place, 1, "one");
+        auto testResult2 = make_payload_in_place(2);
+        ResultWithReturnValue<ErrorCodes1, CountedPayload> testResult3(std::in_place, 3, "three");
+
+        REQUIRE(counter.copies() == 0);
+        REQUIRE(counter.moves() == 0);
+        REQUIRE(testResult1.succeeded());
+        REQUIRE(testResult1.return_value().value() == 1);
+        REQUIRE(testResult1.return_value().text() == "one");
+        REQUIRE(testResult2.return_value().text() == "in place");
+        REQUIRE(testResult3.return_value().value() == 3);
+    }
+
+    {
+        //  An existing value is copied or moved exactly once.
+
+        CountedPayload payload(4, "four");
+
+        CopyCounter counter;
+
+        auto copied = ResultWithReturnValue<ErrorCodes1, CountedPayload>::success(payload);
+
+        REQUIRE(counter.copies() == 1);
+        REQUIRE(counter.moves() == 0);
+
+        auto moved = ResultWithReturnValue<ErrorCodes1, CountedPayload>::success(std::move(payload));
+        auto returned = return_payload(5);
+
+        REQUIRE(counter.copies() == 1);
+        REQUIRE(counter.moves() == 2);
+        REQUIRE(moved.return_value().text() == "four");
+        REQUIRE(returned.return_value().value() == 5);
+    }
+
+    {
+        //  Containers are built directly inside the Result.
+
+        auto testResult = ResultWithReturnValue<ErrorCodes1, std::vector<int>>::success(std::in_place, 1000, 7);
+
+        REQUIRE(testResult.return_value().size() == 1000);
+        REQUIRE(testResult.return_value()[999] == 7);
+    }
+
+    {
+        //  The unique pointer variant allocates the value with make_unique, the allocation being the only one.
+
+        AllocationCounter allocations;
+        CopyCounter counter;
+
+        auto testResult = ResultWithReturnUniquePtr<ErrorCodes1, CountedPayload>::success(std::in_place, 6, "six");
+        ResultWithReturnUniquePtr<ErrorCodes1, CountedPayload> testResult2(std::in_place, 7, "seven");
+
+        REQUIRE(allocations.allocations() == 2);
+        REQUIRE(counter.copies() == 0);
+        REQUIRE(counter.moves() == 0);
+        REQUIRE(testResult.succeeded());
+        REQUIRE(testResult.return_ptr()->value() == 6);
+        REQUIRE(testResult2.return_ptr()->text() == "seven");
+    }
+}
@@ -0,0 +1,268 @@
+#include <catch2/catch_all.hpp>
+
+#include <cstddef>
+#include <vector>
+
+#include "AllocationCounter.hpp"
+#include "CPPResultSerialization.hpp"
+
+//  The pragma below is to disable to false errors flagged by intellisense for
+//  Catch2 REQUIRE macros.
+
+#if __INTELLISENSE__
+#pragma diag_suppress 2486
+#endif
+
+using SEFUtility::Result;
+using SEFUtility::ResultWireFormat;
+using SEFUtility::ResultWithReturnValue;
+using SEFUtility::SerializedResultView;
+using SEFUtility::WireFormatErrorCodes;
+using SEFUtilityTest::AllocationCounter;
+
+using namespace SEFUtility::literals;
+
+enum class StorageErrorCodes
+{
+    SUCCESS = 0,
+    DISK_FULL = 1000,
+    WRITE_FAILED
+};
+
+enum class RequestErrorCodes
+{
+    SUCCESS = 0,
+    REQUEST_FAILED = 2000
+};
+
+TEST_CASE("Result Serialization Test", "[serialization-checks]")
+{
+    {
+        //  A chain round trips through the wire format, the view reads it in place without allocating.
+
+        auto root_cause = Result<StorageErrorCodes>::failure(StorageErrorCodes::DISK_FULL, "disk {} is full", 3);
+        auto middle = Result<StorageErrorCodes>::failure(root_cause, StorageErrorCodes::WRITE_FAILED,
+                                                         "write failed"_msg);
+        auto outer = ResultWithReturnValue<RequestErrorCodes, int>::failure(middle, RequestErrorCodes::REQUEST_FAILED,
+                                                                            "request {} failed", 42);
+
+        std::vector<std::byte> buffer;
+
+        REQUIRE(ResultWireFormat::serialize(outer, buffer).succeeded());
+
+        REQUIRE(buffer.size() == ResultWireFormat::serialized_size(outer));
+
+        AllocationCounter counter;
+
+        auto parsed = SerializedResultView::parse(buffer);
+
+        REQUIRE(parsed.succeeded());
+
+        const SerializedResultView& view = parsed.return_value();
+
+        REQUIRE(view.node_count() == 3);
+        REQUIRE(view.size_bytes() == buffer.size());
+        REQUIRE(view.outermost().failed());
+        REQUIRE(view.outermost().message() == "request 42 failed");
+        REQUIRE(view.outermost().is_code(RequestErrorCodes::REQUEST_FAILED));
+        REQUIRE(view.contains_code(StorageErrorCodes::DISK_FULL));
+        REQUIRE(!view.contains_code(RequestErrorCodes::SUCCESS));
+
+        std::size_t depth = 0;
+
+        for (const auto& node : view)
+        {
+            REQUIRE(node.depth() == depth++);
+            REQUIRE(node.message().data() >= reinterpret_cast<const char*>(buffer.data()));
+            REQUIRE(node.message().data() < reinterpret_cast<const char*>(buffer.data() + buffer.size()));
+        }
+
+        REQUIRE(depth == 3);
+        REQUIRE(counter.allocations() == 0);
+
+        //  Materializing rebuilds the full chain.
+
+        auto materialized = view.materialize<RequestErrorCodes, StorageErrorCodes>();
+
+        REQUIRE(materialized.succeeded());
+
+        const Result<RequestErrorCodes>& rebuilt = materialized.return_value();
+
+        REQUIRE(rebuilt.failed());
+        REQUIRE(rebuilt.error_code() == RequestErrorCodes::REQUEST_FAILED);
+        REQUIRE(rebuilt.message() == "request 42 failed");
+        REQUIRE(rebuilt.inner_error()->error_code_value() == int(StorageErrorCodes::WRITE_FAILED));
+        REQUIRE(rebuilt.inner_error()->message() == "write failed");
+        REQUIRE(rebuilt.inner_error()->inner_error()->message() == "disk 3 is full");
+        REQUIRE(rebuilt.inner_error()->inner_error()->inner_error() == nullptr);
+        REQUIRE(rebuilt.contains_code(StorageErrorCodes::DISK_FULL));
+
+        //  Every domain in the chain must be named.
+
+        auto unknown_inner = view.materialize<RequestErrorCodes>();
+
+        REQUIRE(unknown_inner.failed());
+        REQUIRE(unknown_inner.error_code() == WireFormatErrorCodes::UNKNOWN_DOMAIN);
+
+        auto unknown_outer = view.materialize<StorageErrorCodes>();
+
+        REQUIRE(unknown_outer.error_code() == WireFormatErrorCodes::UNKNOWN_DOMAIN);
+    }
+
+    {
+        //  Records are self delimiting so several may share a stream.
+
+        std::vector<std::byte> buffer;
+
+        ResultWireFormat::serialize(Result<StorageErrorCodes>::success(), buffer);
+        ResultWireFormat::serialize(Result<StorageErrorCodes>::failure(StorageErrorCodes::DISK_FULL, ""), buffer);
+
+        auto first = SerializedResultView::parse(buffer);
+
+        REQUIRE(first.succeeded());
+        REQUIRE(first.return_value().outermost().succeeded());
+        REQUIRE(first.return_value().materialize<StorageErrorCodes>().return_value().succeeded());
+
+        auto second = SerializedResultView::parse(std::span(buffer).subspan(first.return_value().size_bytes()));
+
+        REQUIRE(second.succeeded());
+        REQUIRE(second.return_value().outermost().message().empty());
+        REQUIRE(first.return_value().size_bytes() + second.return_value().size_bytes() == buffer.size());
+
+        auto materialized = second.return_value().materialize<StorageErrorCodes>();
+
+        REQUIRE(materialized.return_value().error_code() == StorageErrorCodes::DISK_FULL);
+    }
+
+    {
+        //  Damaged records are rejected without reading past the buffer.
+
+        std::vector<std::byte> buffer;
+
+        ResultWireFormat::serialize(Result<StorageErrorCodes>::failure(StorageErrorCodes::DISK_FULL, "disk full"),
+                                    buffer);
+
+        for (std::size_t length = 0; length < buffer.size(); length++)
+        {
+            auto truncated = SerializedResultView::parse(std::span(buffer.data(), length));
+
+            REQUIRE(truncated.failed());
+            REQUIRE(truncated.error_code() == WireFormatErrorCodes::TRUNCATED);
+        }
+
+        std::vector<std::byte> bad_header = buffer;
+
+        bad_header[0] = std::byte('X');
+
+        REQUIRE(SerializedResultView::parse(bad_header).error_code() == WireFormatErrorCodes::BAD_HEADER);
+
+        std::vector<std::byte> bad_version = buffer;
+
+        bad_version[2] = std::byte(ResultWireFormat::VERSION + 1);
+
+        REQUIRE(SerializedResultView::parse(bad_version).error_code() == WireFormatErrorCodes::UNSUPPORTED_VERSION);
+
+        std::vector<std::byte> inner_success;
+
+        auto inner = Result<StorageErrorCodes>::failure(StorageErrorCodes::DISK_FULL, "disk full");
+
+        ResultWireFormat::serialize(Result<StorageErrorCodes>::failure(inner, StorageErrorCodes::WRITE_FAILED, "write"),
+                                    inner_success);
+
+        inner_success[ResultWireFormat::HEADER_SIZE + ResultWireFormat::NODE_HEADER_SIZE + 5] = std::byte(0);
+
+        REQUIRE(SerializedResultView::parse(inner_success).error_code() == WireFormatErrorCodes::MALFORMED_CHAIN);
+
+        //  A failure whose error code is zero would assert when materialized.
+
+        std::vector<std::byte> zero_code = buffer;
+
+        ResultWireFormat::store(zero_code.data() + ResultWireFormat::HEADER_SIZE + 9, std::uint32_t(0));
+
+        REQUIRE(SerializedResultView::parse(zero_code).error_code() == WireFormatErrorCodes::MALFORMED_CHAIN);
+
+        //  The writer applies the same rule as the reader, a failure wrapping a success is refused rather than
+        //      written as a record that parse() would reject.
+
+        std::vector<std::byte> wrapped_success = buffer;
+
+        auto outer = Result<StorageErrorCodes>::failure(Result<RequestErrorCodes>::success(),
+                                                        StorageErrorCodes::WRITE_FAILED, "outer");
+        auto serialized = ResultWireFormat::serialize(outer, wrapped_success);
+
+        REQUIRE(serialized.failed());
+        REQUIRE(serialized.error_code() == WireFormatErrorCodes::MALFORMED_CHAIN);
+        REQUIRE(wrapped_success == buffer);
+
+        auto round_trip = SerializedResultView::parse(wrapped_success);
+
+        REQUIRE(round_trip.succeeded());
+        REQUIRE(round_trip.return_value().size_bytes() == wrapped_success.size());
+    }
+
+    {
+        //  Chains are limited in depth, chains up to the limit are rebuilt without recursion.
+
+        auto make_record = [](std::size_t node_count) {
+            std::vector<std::byte> record(ResultWireFormat::HEADER_SIZE +
+                                          node_count * ResultWireFormat::NODE_HEADER_SIZE);
+
+            record[0] = std::byte('C');
+            record[1] = std::byte('R');
+            record[2] = std::byte(ResultWireFormat::VERSION);
+            ResultWireFormat::store(record.data() + 4, std::uint32_t(node_count));
+
+            for (std::size_t i = 0; i < node_count; i++)
+            {
+                std::byte* node =
+                    record.data() + ResultWireFormat::HEADER_SIZE + (i * ResultWireFormat::NODE_HEADER_SIZE);
+
+                ResultWireFormat::store(node, std::uint8_t(1));
+                ResultWireFormat::store(node + 1, SEFUtility::ErrorCodeMetadata<StorageErrorCodes>::domain_id());
+                ResultWireFormat::store(node + 9, std::uint32_t(StorageErrorCodes::DISK_FULL));
+                ResultWireFormat::store(node + 13, std::uint32_t(0));
+            }
+
+            return (record);
+        };
+
+        auto too_deep = make_record(ResultWireFormat::MAX_CHAIN_DEPTH + 1);
+
+        REQUIRE(SerializedResultView::parse(too_deep).error_code() == WireFormatErrorCodes::MALFORMED_CHAIN);
+
+        auto deepest = make_record(ResultWireFormat::MAX_CHAIN_DEPTH);
+        auto parsed = SerializedResultView::parse(deepest);
+
+        REQUIRE(parsed.succeeded());
+
+        auto materialized = parsed.return_value().materialize<StorageErrorCodes, StorageErrorCodes>();
+
+        REQUIRE(materialized.succeeded());
+
+        std::size_t depth = 0;
+
+        for (const SEFUtility::ResultBase* node = &materialized.return_value(); node != nullptr;
+             node = node->inner_error().get())
+        {
+            depth++;
+        }
+
+        REQUIRE(depth == ResultWireFormat::MAX_CHAIN_DEPTH);
+
+        //  The writer refuses a chain the reader would reject and leaves the buffer as it was.
+
+        std::vector<std::byte> buffer;
+
+        REQUIRE(ResultWireFormat::serialize(materialized.return_value(), buffer).succeeded());
+        REQUIRE(buffer == deepest);
+
+        auto over_deep =
+            Result<StorageErrorCodes>::failure(materialized.return_value(), StorageErrorCodes::WRITE_FAILED, "");
+
+        auto serialized = ResultWireFormat::serialize(over_deep, buffer);
+
+        REQUIRE(serialized.failed());
+        REQUIRE(serialized.error_code() == WireFormatErrorCodes::CHAIN_TOO_DEEP);
+        REQUIRE(buffer == deepest);
+    }
+}